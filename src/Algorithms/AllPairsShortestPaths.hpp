@@ -0,0 +1,297 @@
+#pragma once
+
+#include "BellmanFordEngine.hpp"
+#include "CompressedAdjacency.hpp"
+#include "Parallel.hpp"
+#include "ShortestPathEngine.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+struct distanceMatrix
+{
+    size_t numberOfNodes = 0;
+    // Row-major, infinity between nodes that cannot reach each other
+    std::vector<double> distances;
+    // Row-major, the node following the row node on a shortest path to the
+    // column node. Only filled when paths are requested.
+    std::vector<size_t> nextNodes;
+    bool hasNegativeCycle = false;
+};
+
+inline constexpr size_t NO_NEXT_NODE = std::numeric_limits<size_t>::max();
+
+// Matrix holding the lightest arc between every pair of nodes, 0 on the
+// diagonal unless a negative self-loop is lighter
+template <typename IndexType>
+[[nodiscard]] constexpr distanceMatrix arcMatrix(
+    const CompressedAdjacency<IndexType> &graph, bool withPaths)
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    distanceMatrix result;
+    result.numberOfNodes = numberOfNodes;
+    result.distances.assign(numberOfNodes * numberOfNodes,
+                            std::numeric_limits<double>::infinity());
+    if (withPaths)
+        result.nextNodes.assign(numberOfNodes * numberOfNodes, NO_NEXT_NODE);
+
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto row = node * numberOfNodes;
+        result.distances[row + node] = 0;
+        if (withPaths)
+            result.nextNodes[row + node] = node;
+
+        const auto neighbors = graph.getNeighbors(static_cast<IndexType>(node));
+        const auto weights = graph.getWeights(static_cast<IndexType>(node));
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            const auto neighbor = static_cast<size_t>(neighbors[i]);
+            auto &distance = result.distances[row + neighbor];
+            if (weights[i] < distance)
+            {
+                distance = weights[i];
+                if (withPaths)
+                    result.nextNodes[row + neighbor] = neighbor;
+            }
+        }
+    }
+    return result;
+}
+
+// Relaxes the block of rows and columns starting at the given nodes through
+// the block of intermediate nodes. Intermediate nodes are the outer loop, so
+// that the block may overlap the rows or columns it reads, and the inner
+// loop is a branch free minimum over contiguous rows that compilers turn
+// into vector instructions.
+constexpr void relaxBlock(distanceMatrix &matrix, size_t firstRow,
+                          size_t firstColumn, size_t firstPivot,
+                          size_t blockSize)
+{
+    const auto numberOfNodes = matrix.numberOfNodes;
+    const auto endRow = std::min(numberOfNodes, firstRow + blockSize);
+    const auto endColumn = std::min(numberOfNodes, firstColumn + blockSize);
+    const auto endPivot = std::min(numberOfNodes, firstPivot + blockSize);
+    auto *const distances = matrix.distances.data();
+
+    for (size_t pivot = firstPivot; pivot < endPivot; pivot++)
+    {
+        const auto *const pivotRow = distances + (pivot * numberOfNodes);
+        for (size_t row = firstRow; row < endRow; row++)
+        {
+            auto *const targetRow = distances + (row * numberOfNodes);
+            const auto toPivot = targetRow[pivot];
+            if (toPivot == std::numeric_limits<double>::infinity())
+                continue;
+
+            for (size_t column = firstColumn; column < endColumn; column++)
+            {
+                targetRow[column] =
+                    std::min(targetRow[column], toPivot + pivotRow[column]);
+            }
+        }
+    }
+}
+
+// Floyd-Warshall keeping the next node of every path. The blocked order
+// relaxes rows through intermediate nodes that come later in the plain
+// order, which can close cycles of next nodes along zero weight cycles, so
+// pivots are taken in the plain order and only rows are relaxed in parallel.
+// The pivot row only gets shorter through the pivot if the pivot is on a
+// negative cycle, which its diagonal already tells, so it is left as is
+// while the other rows read it.
+constexpr void relaxWithNextNodes(distanceMatrix &matrix)
+{
+    const auto numberOfNodes = matrix.numberOfNodes;
+    for (size_t pivot = 0; pivot < numberOfNodes; pivot++)
+    {
+        const auto pivotRow = std::span<const double>(matrix.distances)
+                                  .subspan(pivot * numberOfNodes,
+                                           numberOfNodes);
+        parallelFor(
+            numberOfNodes,
+            [&](size_t, size_t row) {
+                const auto offset = row * numberOfNodes;
+                const auto toPivot = matrix.distances[offset + pivot];
+                if (row == pivot ||
+                    toPivot == std::numeric_limits<double>::infinity())
+                    return;
+
+                const auto nextToPivot = matrix.nextNodes[offset + pivot];
+                for (size_t column = 0; column < numberOfNodes; column++)
+                {
+                    const auto throughPivot = toPivot + pivotRow[column];
+                    if (throughPivot < matrix.distances[offset + column])
+                    {
+                        matrix.distances[offset + column] = throughPivot;
+                        matrix.nextNodes[offset + column] = nextToPivot;
+                    }
+                }
+            },
+            64);
+    }
+}
+
+// Floyd-Warshall on blocks small enough to stay in cache. For every block of
+// intermediate nodes, the diagonal block is relaxed first, then the blocks
+// sharing its rows or columns, then all the others, the blocks of the last
+// two phases being independent and relaxed in parallel.
+constexpr void relaxInBlocks(distanceMatrix &matrix)
+{
+    constexpr size_t blockSize = 64;
+    const auto numberOfBlocks =
+        (matrix.numberOfNodes + blockSize - 1) / blockSize;
+
+    for (size_t pivotBlock = 0; pivotBlock < numberOfBlocks; pivotBlock++)
+    {
+        const auto pivot = pivotBlock * blockSize;
+        relaxBlock(matrix, pivot, pivot, pivot, blockSize);
+
+        parallelFor(2 * numberOfBlocks, [&](size_t, size_t task) {
+            const auto block = task / 2;
+            if (block == pivotBlock)
+                return;
+            if (task % 2 == 0)
+                relaxBlock(matrix, pivot, block * blockSize, pivot, blockSize);
+            else
+                relaxBlock(matrix, block * blockSize, pivot, pivot, blockSize);
+        });
+
+        parallelFor(numberOfBlocks * numberOfBlocks, [&](size_t, size_t task) {
+            const auto rowBlock = task / numberOfBlocks;
+            const auto columnBlock = task % numberOfBlocks;
+            if (rowBlock != pivotBlock && columnBlock != pivotBlock)
+            {
+                relaxBlock(matrix, rowBlock * blockSize,
+                           columnBlock * blockSize, pivot, blockSize);
+            }
+        });
+    }
+}
+
+template <typename IndexType>
+[[nodiscard]] constexpr distanceMatrix floydWarshall(
+    const CompressedAdjacency<IndexType> &graph, bool withPaths)
+{
+    auto matrix = arcMatrix(graph, withPaths);
+    if (withPaths)
+        relaxWithNextNodes(matrix);
+    else
+        relaxInBlocks(matrix);
+
+    for (size_t node = 0; node < matrix.numberOfNodes; node++)
+    {
+        if (matrix.distances[(node * matrix.numberOfNodes) + node] < 0)
+            matrix.hasNegativeCycle = true;
+    }
+    return matrix;
+}
+
+// Distances from a virtual node linked to every node with weight 0, which is
+// the same as starting from every node at once. Nothing if there is a
+// negative cycle.
+template <typename IndexType>
+[[nodiscard]] constexpr std::optional<std::vector<double>> johnsonPotentials(
+    const CompressedAdjacency<IndexType> &graph)
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    std::vector<IndexType> sources(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        sources[node] = static_cast<IndexType>(node);
+
+    BellmanFordEngine<IndexType> engine(graph);
+    if (!engine.spfa(sources))
+        return std::nullopt;
+
+    std::vector<double> potentials(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        potentials[node] = engine.getDistance(static_cast<IndexType>(node));
+    return potentials;
+}
+
+// Johnson's algorithm: negative weights are first made non negative by
+// potentials that preserve shortest paths, then every node runs its own
+// djikstra, in parallel.
+template <typename IndexType>
+[[nodiscard]] constexpr distanceMatrix johnson(
+    const CompressedAdjacency<IndexType> &graph, bool withPaths)
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    distanceMatrix result;
+    result.numberOfNodes = numberOfNodes;
+    result.distances.assign(numberOfNodes * numberOfNodes,
+                            std::numeric_limits<double>::infinity());
+    if (withPaths)
+        result.nextNodes.assign(numberOfNodes * numberOfNodes, NO_NEXT_NODE);
+
+    const auto potentials = johnsonPotentials(graph);
+    if (!potentials)
+    {
+        result.hasNegativeCycle = true;
+        return result;
+    }
+
+    // Rounding may leave reweighted arcs slightly below 0
+    CompressedAdjacency<IndexType> reweighted(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto neighbors = graph.getNeighbors(static_cast<IndexType>(node));
+        const auto weights = graph.getWeights(static_cast<IndexType>(node));
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            const auto neighbor = static_cast<size_t>(neighbors[i]);
+            reweighted.appendNeighbor(
+                neighbors[i],
+                std::max(0.0, weights[i] + (*potentials)[node] -
+                                  (*potentials)[neighbor]));
+        }
+        reweighted.closeRow();
+    }
+
+    const auto workers = numberOfWorkers(numberOfNodes);
+    std::vector<ShortestPathEngine<IndexType>> engines(
+        workers, ShortestPathEngine<IndexType>(reweighted));
+    parallelFor(
+        numberOfNodes,
+        [&](size_t worker, size_t source) {
+            auto &engine = engines[worker];
+            engine.djikstra(static_cast<IndexType>(source));
+
+            const auto row = source * numberOfNodes;
+            for (const auto node : engine.getSettledNodes())
+            {
+                const auto index = static_cast<size_t>(node);
+                result.distances[row + index] = engine.getDistance(node) -
+                                                (*potentials)[source] +
+                                                (*potentials)[index];
+                if (!withPaths)
+                    continue;
+
+                // Settled nodes come after their parent, whose next node is
+                // already known
+                const auto parent = engine.getParent(node);
+                if (!parent)
+                    result.nextNodes[row + index] = index;
+                else if (static_cast<size_t>(parent.value()) == source)
+                    result.nextNodes[row + index] = index;
+                else
+                {
+                    result.nextNodes[row + index] =
+                        result.nextNodes[row +
+                                         static_cast<size_t>(parent.value())];
+                }
+            }
+        },
+        16);
+    return result;
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,413 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Single source shortest paths over a weighted CompressedAdjacency whose
+// weights may be negative. Every run starts from a set of sources at
+// distance 0 and stops either once no distance can improve or once a
+// negative cycle reachable from the sources is found, in which case the
+// cycle is kept and the distances are meaningless.
+//
+// Cycles are looked for in the graph of parents: any cycle there is a
+// negative one, and one appears in finite time when a negative cycle is
+// reachable. Searching it costs O(V), so it is only done once the runs have
+// gone on longer than a graph without negative cycles would allow.
+template <typename IndexType>
+class BellmanFordEngine
+{
+  public:
+    constexpr explicit BellmanFordEngine(
+        const CompressedAdjacency<IndexType> &graph);
+
+    // Rounds relaxing the arcs of the nodes improved by the previous round,
+    // stopping after the first round that improves nothing. Return false if
+    // a negative cycle was found.
+    constexpr bool bellmanFord(std::span<const IndexType> sources);
+
+    // Queue of improved nodes, a node improving on the head of the queue
+    // being put in front of it (smallest label first) and heads larger than
+    // the queue average being sent back (large label last)
+    constexpr bool spfa(std::span<const IndexType> sources);
+
+    // Rounds in which every node pulls its best distance through its
+    // incoming arcs from the distances of the previous round. Nodes are
+    // relaxed in parallel, at the cost of building the reversed graph once.
+    constexpr bool parallelBellmanFord(std::span<const IndexType> sources);
+
+    [[nodiscard]] constexpr bool isReached(IndexType node) const;
+    [[nodiscard]] constexpr double getDistance(IndexType node) const;
+    [[nodiscard]] constexpr std::optional<IndexType> getParent(
+        IndexType node) const;
+
+    // Nodes of the negative cycle found by the last run in the order of its
+    // arcs, empty if there was none
+    [[nodiscard]] constexpr std::span<const IndexType> getNegativeCycle()
+        const;
+
+  private:
+    static constexpr double UNREACHED = std::numeric_limits<double>::infinity();
+    static constexpr size_t NOT_WALKED = std::numeric_limits<size_t>::max();
+
+    const CompressedAdjacency<IndexType> *graph;
+    std::vector<double> distances;
+    std::vector<IndexType> parents;
+    std::vector<IndexType> negativeCycle;
+
+    // Walk through which every node was last reached by findNegativeCycle
+    std::vector<size_t> walks;
+
+    // Reversed graph, only built for parallel runs
+    CompressedAdjacency<IndexType> incoming;
+
+    constexpr void reset(std::span<const IndexType> sources);
+    constexpr bool findNegativeCycle();
+    constexpr void buildIncoming();
+};
+
+template <typename IndexType>
+constexpr BellmanFordEngine<IndexType>::BellmanFordEngine(
+    const CompressedAdjacency<IndexType> &graphToTraverse)
+    : graph(&graphToTraverse),
+      distances(graphToTraverse.getNumberOfNodes(), UNREACHED),
+      parents(graphToTraverse.getNumberOfNodes())
+{
+}
+
+template <typename IndexType>
+constexpr void BellmanFordEngine<IndexType>::reset(
+    std::span<const IndexType> sources)
+{
+    std::ranges::fill(distances, UNREACHED);
+    negativeCycle.clear();
+    for (const auto source : sources)
+    {
+        distances[static_cast<size_t>(source)] = 0;
+        parents[static_cast<size_t>(source)] = source;
+    }
+}
+
+template <typename IndexType>
+constexpr bool BellmanFordEngine<IndexType>::bellmanFord(
+    std::span<const IndexType> sources)
+{
+    reset(sources);
+    const auto numberOfNodes = graph->getNumberOfNodes();
+
+    std::vector<uint8_t> active(numberOfNodes, 0);
+    std::vector<uint8_t> nextActive(numberOfNodes, 0);
+    for (const auto source : sources)
+        active[static_cast<size_t>(source)] = 1;
+
+    for (size_t round = 1;; round++)
+    {
+        bool improved = false;
+        for (size_t node = 0; node < numberOfNodes; node++)
+        {
+            if (active[node] == 0)
+                continue;
+            active[node] = 0;
+
+            const auto neighbors =
+                graph->getNeighbors(static_cast<IndexType>(node));
+            const auto weights =
+                graph->getWeights(static_cast<IndexType>(node));
+            for (size_t i = 0; i < neighbors.size(); i++)
+            {
+                const auto neighbor = static_cast<size_t>(neighbors[i]);
+                const auto distance = distances[node] + weights[i];
+                if (distance >= distances[neighbor])
+                    continue;
+                if (neighbor == node)
+                {
+                    negativeCycle.assign(1, neighbors[i]);
+                    return false;
+                }
+                distances[neighbor] = distance;
+                parents[neighbor] = static_cast<IndexType>(node);
+                nextActive[neighbor] = 1;
+                improved = true;
+            }
+        }
+        if (!improved)
+            return true;
+
+        // Without negative cycles, shortest paths have fewer arcs than
+        // there are nodes and the last round of them improves nothing
+        if (round >= numberOfNodes && findNegativeCycle())
+            return false;
+        std::swap(active, nextActive);
+    }
+}
+
+template <typename IndexType>
+constexpr bool BellmanFordEngine<IndexType>::spfa(
+    std::span<const IndexType> sources)
+{
+    reset(sources);
+    const auto numberOfNodes = graph->getNumberOfNodes();
+
+    // Arcs on the path through which every node was last improved. A path
+    // with as many arcs as there are nodes proves a negative cycle exists.
+    std::vector<size_t> pathArcs(numberOfNodes, 0);
+    std::vector<uint8_t> queued(numberOfNodes, 0);
+    std::deque<IndexType> queue;
+    double queuedDistances = 0;
+    for (const auto source : sources)
+    {
+        if (queued[static_cast<size_t>(source)] == 0)
+        {
+            queued[static_cast<size_t>(source)] = 1;
+            queue.emplace_back(source);
+        }
+    }
+
+    bool cycleSuspected = false;
+    size_t improvementsSinceSearch = 0;
+    while (!queue.empty())
+    {
+        for (size_t moved = 0; moved + 1 < queue.size(); moved++)
+        {
+            const auto head = static_cast<size_t>(queue.front());
+            if (distances[head] * static_cast<double>(queue.size()) <=
+                queuedDistances)
+                break;
+            queue.push_back(queue.front());
+            queue.pop_front();
+        }
+
+        const auto node = static_cast<size_t>(queue.front());
+        queue.pop_front();
+        queued[node] = 0;
+        queuedDistances -= distances[node];
+
+        const auto neighbors =
+            graph->getNeighbors(static_cast<IndexType>(node));
+        const auto weights = graph->getWeights(static_cast<IndexType>(node));
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            const auto neighbor = static_cast<size_t>(neighbors[i]);
+            const auto distance = distances[node] + weights[i];
+            if (distance >= distances[neighbor])
+                continue;
+
+            if (neighbor == node)
+            {
+                negativeCycle.assign(1, neighbors[i]);
+                return false;
+            }
+
+            if (queued[neighbor] != 0)
+                queuedDistances += distance - distances[neighbor];
+            else
+            {
+                queued[neighbor] = 1;
+                queuedDistances += distance;
+                if (!queue.empty() &&
+                    distance < distances[static_cast<size_t>(queue.front())])
+                    queue.emplace_front(neighbors[i]);
+                else
+                    queue.emplace_back(neighbors[i]);
+            }
+            distances[neighbor] = distance;
+            parents[neighbor] = static_cast<IndexType>(node);
+            pathArcs[neighbor] = pathArcs[node] + 1;
+
+            if (pathArcs[neighbor] >= numberOfNodes)
+                cycleSuspected = true;
+            if (cycleSuspected && ++improvementsSinceSearch >= numberOfNodes)
+            {
+                improvementsSinceSearch = 0;
+                if (findNegativeCycle())
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename IndexType>
+constexpr bool BellmanFordEngine<IndexType>::parallelBellmanFord(
+    std::span<const IndexType> sources)
+{
+    reset(sources);
+    buildIncoming();
+    const auto numberOfNodes = graph->getNumberOfNodes();
+
+    std::vector<double> nextDistances(distances);
+    std::vector<uint8_t> improved(numberOfNodes, 0);
+    std::vector<uint8_t> nextImproved(numberOfNodes, 0);
+    for (const auto source : sources)
+        improved[static_cast<size_t>(source)] = 1;
+
+    for (size_t round = 1;; round++)
+    {
+        std::atomic<bool> anyImproved = false;
+        std::atomic<size_t> selfLoopNode = NOT_WALKED;
+        parallelFor(
+            numberOfNodes,
+            [&](size_t, size_t node) {
+                nextImproved[node] = 0;
+                const auto tails =
+                    incoming.getNeighbors(static_cast<IndexType>(node));
+                const auto weights =
+                    incoming.getWeights(static_cast<IndexType>(node));
+                for (size_t i = 0; i < tails.size(); i++)
+                {
+                    const auto tail = static_cast<size_t>(tails[i]);
+                    if (improved[tail] == 0)
+                        continue;
+                    const auto distance = distances[tail] + weights[i];
+                    if (tail == node && distance < distances[node])
+                        selfLoopNode.store(node, std::memory_order_relaxed);
+                    else if (distance < nextDistances[node])
+                    {
+                        nextDistances[node] = distance;
+                        parents[node] = tails[i];
+                        nextImproved[node] = 1;
+                    }
+                }
+                if (nextImproved[node] != 0)
+                    anyImproved.store(true, std::memory_order_relaxed);
+            },
+            256);
+        if (selfLoopNode != NOT_WALKED)
+        {
+            negativeCycle.assign(1, static_cast<IndexType>(selfLoopNode));
+            return false;
+        }
+        if (!anyImproved)
+            return true;
+
+        distances = nextDistances;
+        if (round >= numberOfNodes && findNegativeCycle())
+            return false;
+        std::swap(improved, nextImproved);
+    }
+}
+
+template <typename IndexType>
+constexpr bool BellmanFordEngine<IndexType>::findNegativeCycle()
+{
+    const auto numberOfNodes = graph->getNumberOfNodes();
+    walks.assign(numberOfNodes, NOT_WALKED);
+
+    // Follows parents from every node, each walk stopping on the roots or on
+    // nodes of earlier walks. Meeting a node of the current walk closes a
+    // cycle.
+    for (size_t start = 0; start < numberOfNodes; start++)
+    {
+        if (distances[start] == UNREACHED || walks[start] != NOT_WALKED)
+            continue;
+
+        auto node = start;
+        while (walks[node] == NOT_WALKED)
+        {
+            walks[node] = start;
+            const auto parent = static_cast<size_t>(parents[node]);
+            if (parent == node)
+                break;
+            node = parent;
+        }
+        if (walks[node] != start || static_cast<size_t>(parents[node]) == node)
+            continue;
+
+        negativeCycle.clear();
+        auto cycleNode = node;
+        do
+        {
+            negativeCycle.emplace_back(static_cast<IndexType>(cycleNode));
+            cycleNode = static_cast<size_t>(parents[cycleNode]);
+        } while (cycleNode != node);
+        std::ranges::reverse(negativeCycle);
+        return true;
+    }
+    return false;
+}
+
+template <typename IndexType>
+constexpr void BellmanFordEngine<IndexType>::buildIncoming()
+{
+    const auto numberOfNodes = graph->getNumberOfNodes();
+    if (incoming.getNumberOfNodes() == numberOfNodes)
+        return;
+
+    // Counting sort of the arcs by head
+    std::vector<size_t> offsets(numberOfNodes + 1, 0);
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        for (const auto neighbor :
+             graph->getNeighbors(static_cast<IndexType>(node)))
+            offsets[static_cast<size_t>(neighbor) + 1]++;
+    }
+    for (size_t node = 0; node < numberOfNodes; node++)
+        offsets[node + 1] += offsets[node];
+
+    std::vector<std::pair<IndexType, double>> arcs(graph->getNumberOfArcs());
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto neighbors =
+            graph->getNeighbors(static_cast<IndexType>(node));
+        const auto weights = graph->getWeights(static_cast<IndexType>(node));
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            arcs[offsets[static_cast<size_t>(neighbors[i])]++] = {
+                static_cast<IndexType>(node), weights[i]};
+        }
+    }
+
+    incoming = CompressedAdjacency<IndexType>(numberOfNodes);
+    size_t arc = 0;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        for (; arc < offsets[node]; arc++)
+            incoming.appendNeighbor(arcs[arc].first, arcs[arc].second);
+        incoming.closeRow();
+    }
+}
+
+template <typename IndexType>
+constexpr bool BellmanFordEngine<IndexType>::isReached(IndexType node) const
+{
+    return distances[static_cast<size_t>(node)] != UNREACHED;
+}
+
+template <typename IndexType>
+constexpr double BellmanFordEngine<IndexType>::getDistance(
+    IndexType node) const
+{
+    return distances[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr std::optional<IndexType> BellmanFordEngine<IndexType>::getParent(
+    IndexType node) const
+{
+    const auto index = static_cast<size_t>(node);
+    if (distances[index] == UNREACHED || parents[index] == node)
+        return std::nullopt;
+    return parents[index];
+}
+
+template <typename IndexType>
+constexpr std::span<const IndexType> BellmanFordEngine<
+    IndexType>::getNegativeCycle() const
+{
+    return negativeCycle;
+}
+
+} // namespace jGraph::internals
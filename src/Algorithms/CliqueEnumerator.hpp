@@ -0,0 +1,357 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "NodeOrderings.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Bron-Kerbosch enumeration of the maximal cliques with Tomita pivoting.
+// Following Eppstein, Loffler and Strash, every node starts its own search
+// restricted to its neighborhood, the neighbors placed before it in a
+// degeneracy order being the candidates and the other ones the excluded
+// nodes, so that every clique is reported once and candidate sets stay below
+// the degeneracy. Small searches run on bitsets of their nodes, large ones on
+// sorted index vectors until they become small.
+template <typename IndexType>
+class CliqueEnumerator
+{
+  public:
+    // The graph must have sorted rows without self-loops
+    constexpr explicit CliqueEnumerator(
+        const CompressedAdjacency<IndexType> &graph);
+
+    // Calls onClique(worker, clique) for every maximal clique. Top level
+    // nodes are searched in parallel, workers are numbered as in parallelFor.
+    template <typename Callback>
+    constexpr void forEachMaximalClique(Callback &&onClique) const;
+
+    [[nodiscard]] constexpr size_t getNumberOfWorkers() const;
+
+  private:
+    static constexpr size_t BITS_PER_WORD = 64;
+    static constexpr size_t BITSET_LIMIT = 256;
+    static constexpr size_t NOT_LOCAL = std::numeric_limits<size_t>::max();
+
+    // Scratch memory of one worker. Bitset searches number their nodes
+    // locally, every recursion level owning a candidate, an excluded and a
+    // branching set of words.
+    struct Workspace
+    {
+        std::vector<IndexType> clique;
+        std::vector<IndexType> localNodes;
+        std::vector<size_t> localPositions;
+        std::vector<uint64_t> localAdjacency;
+        std::vector<uint64_t> levels;
+        size_t words = 0;
+    };
+
+    const CompressedAdjacency<IndexType> *graph;
+    std::vector<size_t> ranks;
+
+    template <typename Callback>
+    constexpr void searchVectors(Workspace &workspace,
+                                 std::span<const IndexType> candidates,
+                                 std::span<const IndexType> excluded,
+                                 size_t worker, Callback &onClique) const;
+
+    template <typename Callback>
+    constexpr void searchBitsets(Workspace &workspace,
+                                 std::span<const IndexType> candidates,
+                                 std::span<const IndexType> excluded,
+                                 size_t worker, Callback &onClique) const;
+
+    template <typename Callback>
+    constexpr void expandBitsets(Workspace &workspace, size_t depth,
+                                 size_t worker, Callback &onClique) const;
+};
+
+template <typename IndexType>
+constexpr CliqueEnumerator<IndexType>::CliqueEnumerator(
+    const CompressedAdjacency<IndexType> &adjacency)
+    : graph(&adjacency), ranks(adjacency.getNumberOfNodes())
+{
+    const auto order = smallestLastOrder(adjacency);
+    for (size_t rank = 0; rank < order.size(); rank++)
+        ranks[static_cast<size_t>(order[rank])] = rank;
+}
+
+template <typename IndexType>
+constexpr size_t CliqueEnumerator<IndexType>::getNumberOfWorkers() const
+{
+    return numberOfWorkers(graph->getNumberOfNodes());
+}
+
+template <typename IndexType>
+template <typename Callback>
+constexpr void CliqueEnumerator<IndexType>::forEachMaximalClique(
+    Callback &&onClique) const
+{
+    std::vector<Workspace> workspaces(getNumberOfWorkers());
+    parallelFor(
+        graph->getNumberOfNodes(),
+        [&](size_t worker, size_t task) {
+            auto &workspace = workspaces[worker];
+            const auto node = static_cast<IndexType>(task);
+
+            std::vector<IndexType> candidates;
+            std::vector<IndexType> excluded;
+            for (const auto neighbor : graph->getNeighbors(node))
+            {
+                if (ranks[static_cast<size_t>(neighbor)] < ranks[task])
+                    candidates.emplace_back(neighbor);
+                else
+                    excluded.emplace_back(neighbor);
+            }
+
+            workspace.clique.assign(1, node);
+            searchVectors(workspace, candidates, excluded, worker, onClique);
+        },
+        8);
+}
+
+template <typename IndexType>
+template <typename Callback>
+constexpr void CliqueEnumerator<IndexType>::searchVectors(
+    Workspace &workspace, std::span<const IndexType> candidateNodes,
+    std::span<const IndexType> excludedNodes, size_t worker,
+    Callback &onClique) const
+{
+    if (candidateNodes.size() + excludedNodes.size() <= BITSET_LIMIT)
+    {
+        searchBitsets(workspace, candidateNodes, excludedNodes, worker,
+                      onClique);
+        return;
+    }
+    if (candidateNodes.empty())
+        return;
+
+    // Tomita pivot: the node with the most candidate neighbors, whose
+    // candidate neighbors need not start a branch
+    const auto countCandidateNeighbors = [&](IndexType node) {
+        size_t count = 0;
+        const auto neighbors = graph->getNeighbors(node);
+        auto candidate = candidateNodes.begin();
+        auto neighbor = neighbors.begin();
+        while (candidate != candidateNodes.end() && neighbor != neighbors.end())
+        {
+            if (*candidate < *neighbor)
+                ++candidate;
+            else if (*neighbor < *candidate)
+                ++neighbor;
+            else
+            {
+                count++;
+                ++candidate;
+                ++neighbor;
+            }
+        }
+        return count;
+    };
+
+    IndexType pivot = candidateNodes.front();
+    size_t pivotCount = 0;
+    for (const auto nodes : {candidateNodes, excludedNodes})
+    {
+        for (const auto node : nodes)
+        {
+            const auto count = countCandidateNeighbors(node);
+            if (count > pivotCount)
+            {
+                pivot = node;
+                pivotCount = count;
+            }
+        }
+    }
+
+    std::vector<IndexType> branches;
+    std::ranges::set_difference(candidateNodes, graph->getNeighbors(pivot),
+                                std::back_inserter(branches));
+
+    std::vector<IndexType> candidates(candidateNodes.begin(),
+                                      candidateNodes.end());
+    std::vector<IndexType> excluded(excludedNodes.begin(), excludedNodes.end());
+    std::vector<IndexType> nextCandidates;
+    std::vector<IndexType> nextExcluded;
+    for (const auto node : branches)
+    {
+        candidates.erase(std::ranges::lower_bound(candidates, node));
+
+        const auto neighbors = graph->getNeighbors(node);
+        nextCandidates.clear();
+        nextExcluded.clear();
+        std::ranges::set_intersection(candidates, neighbors,
+                                      std::back_inserter(nextCandidates));
+        std::ranges::set_intersection(excluded, neighbors,
+                                      std::back_inserter(nextExcluded));
+
+        workspace.clique.emplace_back(node);
+        searchVectors(workspace, nextCandidates, nextExcluded, worker,
+                      onClique);
+        workspace.clique.pop_back();
+
+        excluded.insert(std::ranges::lower_bound(excluded, node), node);
+    }
+}
+
+template <typename IndexType>
+template <typename Callback>
+constexpr void CliqueEnumerator<IndexType>::searchBitsets(
+    Workspace &workspace, std::span<const IndexType> candidates,
+    std::span<const IndexType> excluded, size_t worker,
+    Callback &onClique) const
+{
+    auto &localNodes = workspace.localNodes;
+    auto &localPositions = workspace.localPositions;
+    localNodes.assign(candidates.begin(), candidates.end());
+    localNodes.insert(localNodes.end(), excluded.begin(), excluded.end());
+    if (localPositions.empty())
+        localPositions.assign(graph->getNumberOfNodes(), NOT_LOCAL);
+
+    const auto size = localNodes.size();
+    const auto words = (size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+    for (size_t local = 0; local < size; local++)
+        localPositions[static_cast<size_t>(localNodes[local])] = local;
+
+    // Rows much longer than the neighborhood are probed with binary searches
+    // instead of being scanned
+    auto &adjacency = workspace.localAdjacency;
+    adjacency.assign(size * words, 0);
+    for (size_t local = 0; local < size; local++)
+    {
+        const auto row = std::span<uint64_t>(adjacency).subspan(local * words,
+                                                                words);
+        const auto neighbors = graph->getNeighbors(localNodes[local]);
+        if (neighbors.size() <= 8 * size)
+        {
+            for (const auto neighbor : neighbors)
+            {
+                const auto other =
+                    localPositions[static_cast<size_t>(neighbor)];
+                if (other != NOT_LOCAL)
+                    row[other / BITS_PER_WORD] |= uint64_t{1}
+                                                  << (other % BITS_PER_WORD);
+            }
+            continue;
+        }
+        for (size_t other = 0; other < size; other++)
+        {
+            if (graph->containsNeighbor(localNodes[local], localNodes[other]))
+                row[other / BITS_PER_WORD] |= uint64_t{1}
+                                              << (other % BITS_PER_WORD);
+        }
+    }
+    for (const auto node : localNodes)
+        localPositions[static_cast<size_t>(node)] = NOT_LOCAL;
+
+    // Every level adds a candidate to the clique, so there are at most
+    // size + 1 of them
+    workspace.words = words;
+    workspace.levels.assign((size + 1) * 3 * words, 0);
+    for (size_t local = 0; local < size; local++)
+    {
+        const auto set = local < candidates.size() ? 0 : words;
+        workspace.levels[set + (local / BITS_PER_WORD)] |=
+            uint64_t{1} << (local % BITS_PER_WORD);
+    }
+    expandBitsets(workspace, 0, worker, onClique);
+}
+
+template <typename IndexType>
+template <typename Callback>
+constexpr void CliqueEnumerator<IndexType>::expandBitsets(
+    Workspace &workspace, size_t depth, size_t worker,
+    Callback &onClique) const
+{
+    const auto words = workspace.words;
+    const auto level =
+        std::span<uint64_t>(workspace.levels).subspan(depth * 3 * words,
+                                                       3 * words);
+    const auto candidates = level.first(words);
+    const auto excluded = level.subspan(words, words);
+    const auto branches = level.last(words);
+    const auto adjacency = [&](size_t local) {
+        return std::span<const uint64_t>(workspace.localAdjacency)
+            .subspan(local * words, words);
+    };
+
+    const auto isEmpty = [](std::span<const uint64_t> set) {
+        return std::ranges::all_of(set, [](uint64_t word) {
+            return word == 0;
+        });
+    };
+    if (isEmpty(candidates))
+    {
+        if (isEmpty(excluded))
+        {
+            onClique(worker, std::span<const IndexType>(workspace.clique));
+        }
+        return;
+    }
+
+    size_t pivot = NOT_LOCAL;
+    size_t pivotCount = 0;
+    for (size_t word = 0; word < words; word++)
+    {
+        for (auto bits = candidates[word] | excluded[word]; bits != 0;
+             bits &= bits - 1)
+        {
+            const auto local = (word * BITS_PER_WORD) +
+                               static_cast<size_t>(std::countr_zero(bits));
+            const auto neighbors = adjacency(local);
+            size_t count = 0;
+            for (size_t other = 0; other < words; other++)
+            {
+                count += static_cast<size_t>(
+                    std::popcount(candidates[other] & neighbors[other]));
+            }
+            if (pivot == NOT_LOCAL || count > pivotCount)
+            {
+                pivot = local;
+                pivotCount = count;
+            }
+        }
+    }
+
+    const auto pivotNeighbors = adjacency(pivot);
+    for (size_t word = 0; word < words; word++)
+        branches[word] = candidates[word] & ~pivotNeighbors[word];
+
+    const auto next = std::span<uint64_t>(workspace.levels)
+                          .subspan((depth + 1) * 3 * words, 2 * words);
+    for (size_t word = 0; word < words; word++)
+    {
+        for (auto bits = branches[word]; bits != 0; bits &= bits - 1)
+        {
+            const auto local = (word * BITS_PER_WORD) +
+                               static_cast<size_t>(std::countr_zero(bits));
+            const auto bit = uint64_t{1} << (local % BITS_PER_WORD);
+            candidates[word] &= ~bit;
+
+            const auto neighbors = adjacency(local);
+            for (size_t other = 0; other < words; other++)
+            {
+                next[other] = candidates[other] & neighbors[other];
+                next[words + other] = excluded[other] & neighbors[other];
+            }
+
+            workspace.clique.emplace_back(workspace.localNodes[local]);
+            expandBitsets(workspace, depth + 1, worker, onClique);
+            workspace.clique.pop_back();
+
+            excluded[word] |= bit;
+        }
+    }
+}
+
+} // namespace jGraph::internals
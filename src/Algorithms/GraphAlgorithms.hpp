@@ -1,15 +1,21 @@
 #pragma once
 
 #include "DefaultTypes.hpp"
+#include "GraphBiconnectivity.hpp"
+#include "GraphCliques.hpp"
+#include "GraphColoring.hpp"
+#include "GraphCommunities.hpp"
+#include "GraphFlows.hpp"
+#include "GraphMatching.hpp"
+#include "GraphPaths.hpp"
+#include "GraphPatternMatching.hpp"
 #include "GraphPrimitives.hpp"
+#include "GraphRandomWalks.hpp"
+#include "GraphSpanningTrees.hpp"
+#include "ShortestPathEngine.hpp"
 
 #include <algorithm>
-#include <cassert>
-#include <cfloat>
 #include <cstdio>
-#include <limits>
-#include <optional>
-#include <queue>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -18,7 +24,17 @@ namespace jGraph
 {
 
 template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
-class GraphAlgorithms : public virtual GraphPrimitives<T, IndexType>
+class GraphAlgorithms : public GraphBiconnectivity<T, IndexType>,
+                        public GraphCliques<T, IndexType>,
+                        public GraphColoring<T, IndexType>,
+                        public GraphCommunities<T, IndexType>,
+                        public GraphFlows<T, IndexType>,
+                        public GraphMatching<T, IndexType>,
+                        public GraphPaths<T, IndexType>,
+                        public GraphPatternMatching<T, IndexType>,
+                        public GraphRandomWalks<T, IndexType>,
+                        public GraphSpanningTrees<T, IndexType>,
+                        public virtual GraphPrimitives<T, IndexType>
 {
   public:
     [[nodiscard]] constexpr bool isConnected() const;
@@ -159,7 +175,7 @@ constexpr std::vector<std::pair<T, T>> GraphAlgorithms<T, IndexType>::djikstra(
     {
         const auto first = this->getNodeMap().convertIndexToNodeName(fromNode);
         const auto second = this->getNodeMap().convertIndexToNodeName(node);
-        result.emplace_back({first, second});
+        result.emplace_back(first, second);
     }
     return result;
 }
@@ -168,59 +184,15 @@ template <typename T, typename IndexType>
 constexpr std::vector<std::pair<IndexType, IndexType>> GraphAlgorithms<
     T, IndexType>::internal_djikstra(IndexType startingNode) const
 {
-    // Data structures necessary for the algorithm
-    // ------------------------------------------------------------------------
-    const auto numNodes = this->getNumberOfNodes();
-    std::vector<std::optional<IndexType>> previousNodes(numNodes, std::nullopt);
-    std::vector<double> distances(numNodes,
-                                  std::numeric_limits<double>::infinity());
-    distances.at(startingNode) = 0;
-
-    auto comparaisonFunction = [](std::pair<IndexType, double> lhs,
-                                  std::pair<IndexType, double> rhs) {
-        return lhs.second > rhs.second;
-    };
-
-    std::priority_queue<std::pair<IndexType, double>,
-                        std::vector<std::pair<IndexType, double>>,
-                        decltype(comparaisonFunction)>
-        nodesPriorityQueue(comparaisonFunction);
-    // Algorithm
-    // ------------------------------------------------------------------------
-    nodesPriorityQueue.emplace({startingNode, 0});
-    while (!nodesPriorityQueue.empty())
-    {
-        const auto [currentBestNode, currentBestDistance] =
-            nodesPriorityQueue.top();
-        nodesPriorityQueue.pop();
-
-        if (currentBestDistance > distances[currentBestNode])
-            continue;
-
-        for (const IndexType examinedNeighbor :
-             this->internal_getNeighbors(currentBestNode))
-        {
-            const double edgeWeight =
-                this->getWeight(currentBestNode, examinedNeighbor);
-            assert(edgeWeight >= 0);
+    const auto graph = this->internal_compressOutgoingNeighbors(true);
+    internals::ShortestPathEngine<IndexType> engine(graph);
+    engine.djikstra(startingNode);
 
-            double examinedDistance = distances[currentBestNode] + edgeWeight;
-
-            if (examinedDistance < distances.at(examinedNeighbor))
-            {
-                distances[examinedNeighbor] = examinedDistance;
-                previousNodes[examinedNeighbor] = currentBestNode;
-                nodesPriorityQueue.emplace(examinedNeighbor, examinedDistance);
-            }
-        }
-    }
-    // Result construction
-    // ------------------------------------------------------------------------
     std::vector<std::pair<IndexType, IndexType>> result;
-    for (const auto &node : this->internal_getNodes())
+    for (const auto node : engine.getSettledNodes())
     {
-        if (previousNodes[node])
-            result.emplace_back(previousNodes[node].value(), node);
+        if (const auto previousNode = engine.getParent(node))
+            result.emplace_back(previousNode.value(), node);
     }
     return result;
 }
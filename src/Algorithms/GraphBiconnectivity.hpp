@@ -0,0 +1,216 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+namespace internals
+{
+
+template <typename IndexType>
+struct biconnectivityResult
+{
+    std::vector<bool> isArticulationPoint;
+    std::vector<std::pair<IndexType, IndexType>> bridges;
+    std::vector<std::vector<IndexType>> components;
+};
+
+} // namespace internals
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphBiconnectivity : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Nodes whose removal disconnects their component
+    [[nodiscard]] constexpr std::vector<T> articulationPoints() const;
+
+    // Edges whose removal disconnects their component
+    [[nodiscard]] constexpr std::vector<std::pair<T, T>> bridges() const;
+
+    // Nodes of every maximal subgraph that stays connected after removing any
+    // single node. Articulation points belong to several of them and nodes
+    // without edges to none.
+    [[nodiscard]] constexpr std::vector<std::vector<T>> biconnectedComponents()
+        const;
+
+  private:
+    // Hopcroft-Tarjan depth first search, run on an explicit stack so that
+    // long paths such as the ones of road networks cannot overflow the call
+    // stack. Edge directions are ignored.
+    [[nodiscard]] constexpr internals::biconnectivityResult<IndexType>
+    internal_biconnectivity() const;
+};
+
+template <typename T, typename IndexType>
+constexpr std::vector<T> GraphBiconnectivity<T, IndexType>::articulationPoints()
+    const
+{
+    const auto isArticulationPoint =
+        internal_biconnectivity().isArticulationPoint;
+
+    std::vector<T> result;
+    for (size_t node = 0; node < isArticulationPoint.size(); node++)
+    {
+        if (isArticulationPoint[node])
+        {
+            result.emplace_back(this->getNodeMap().convertIndexToNodeName(
+                static_cast<IndexType>(node)));
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, T>> GraphBiconnectivity<
+    T, IndexType>::bridges() const
+{
+    const auto bridgesAsIndexes = internal_biconnectivity().bridges;
+
+    std::vector<std::pair<T, T>> result;
+    result.reserve(bridgesAsIndexes.size());
+    for (const auto &[from, to] : bridgesAsIndexes)
+    {
+        result.emplace_back(this->getNodeMap().convertIndexToNodeName(from),
+                            this->getNodeMap().convertIndexToNodeName(to));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::vector<T>> GraphBiconnectivity<
+    T, IndexType>::biconnectedComponents() const
+{
+    const auto components = internal_biconnectivity().components;
+
+    std::vector<std::vector<T>> result;
+    result.reserve(components.size());
+    for (const auto &component : components)
+    {
+        result.emplace_back(
+            this->getNodeMap().convertIndexToNodeName(component));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr internals::biconnectivityResult<IndexType> GraphBiconnectivity<
+    T, IndexType>::internal_biconnectivity() const
+{
+    struct Frame
+    {
+        IndexType node;
+        size_t nextNeighbor;
+        bool skippedParentEdge;
+    };
+
+    constexpr auto unvisited = std::numeric_limits<size_t>::max();
+    const auto graph = this->internal_compressNeighbors();
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    internals::biconnectivityResult<IndexType> result;
+    result.isArticulationPoint.assign(numberOfNodes, false);
+
+    std::vector<size_t> discovery(numberOfNodes, unvisited);
+    std::vector<size_t> low(numberOfNodes, 0);
+    std::vector<size_t> lastComponent(numberOfNodes, unvisited);
+    std::vector<Frame> stack;
+    std::vector<std::pair<IndexType, IndexType>> edgeStack;
+    size_t time = 0;
+
+    for (size_t root = 0; root < numberOfNodes; root++)
+    {
+        if (discovery[root] != unvisited)
+            continue;
+
+        size_t rootChildren = 0;
+        discovery[root] = low[root] = time++;
+        stack.push_back({static_cast<IndexType>(root), 0, false});
+        while (!stack.empty())
+        {
+            auto &frame = stack.back();
+            const auto node = frame.node;
+            const auto index = static_cast<size_t>(node);
+            const auto neighbors = graph.getNeighbors(node);
+
+            if (frame.nextNeighbor < neighbors.size())
+            {
+                const auto neighbor = neighbors[frame.nextNeighbor++];
+                const auto neighborIndex = static_cast<size_t>(neighbor);
+                if (neighbor == node)
+                    continue;
+
+                // Only the edge the node was reached through is skipped, a
+                // parallel edge to the parent still counts as a back edge
+                if (stack.size() > 1 &&
+                    neighbor == stack[stack.size() - 2].node &&
+                    !frame.skippedParentEdge)
+                {
+                    frame.skippedParentEdge = true;
+                    continue;
+                }
+
+                if (discovery[neighborIndex] == unvisited)
+                {
+                    discovery[neighborIndex] = low[neighborIndex] = time++;
+                    edgeStack.emplace_back(node, neighbor);
+                    stack.push_back({neighbor, 0, false});
+                }
+                else if (discovery[neighborIndex] < discovery[index])
+                {
+                    low[index] = std::min(low[index], discovery[neighborIndex]);
+                    edgeStack.emplace_back(node, neighbor);
+                }
+                continue;
+            }
+
+            stack.pop_back();
+            if (stack.empty())
+                break;
+
+            const auto parent = stack.back().node;
+            const auto parentIndex = static_cast<size_t>(parent);
+            low[parentIndex] = std::min(low[parentIndex], low[index]);
+            if (low[index] > discovery[parentIndex])
+                result.bridges.emplace_back(parent, node);
+            if (low[index] < discovery[parentIndex])
+                continue;
+
+            // The parent separates the subtree of the node from the rest of
+            // the graph, the edges explored since form a component
+            if (parentIndex != root || ++rootChildren > 1)
+                result.isArticulationPoint[parentIndex] = true;
+
+            std::vector<IndexType> component;
+            const auto componentId = result.components.size();
+            while (true)
+            {
+                const auto edge = edgeStack.back();
+                edgeStack.pop_back();
+                for (const auto extremity : {edge.first, edge.second})
+                {
+                    auto &last = lastComponent[static_cast<size_t>(extremity)];
+                    if (last != componentId)
+                    {
+                        last = componentId;
+                        component.emplace_back(extremity);
+                    }
+                }
+                if (edge.first == parent && edge.second == node)
+                    break;
+            }
+            result.components.emplace_back(std::move(component));
+        }
+    }
+    return result;
+}
+
+}; // namespace jGraph
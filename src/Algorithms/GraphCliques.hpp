@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CliqueEnumerator.hpp"
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace jGraph
+{
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphCliques : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Calls onClique(std::span<const T>) once for every maximal clique, in
+    // no particular order, without storing them. Calls come from several
+    // threads at once, so the callback has to be thread safe, and the span
+    // is only valid during the call. Edge directions are ignored.
+    template <typename Callback>
+    constexpr void forEachMaximalClique(Callback &&onClique) const;
+
+    [[nodiscard]] constexpr std::vector<std::vector<T>> maximalCliques()
+        const;
+
+  private:
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_cliqueAdjacency() const;
+};
+
+template <typename T, typename IndexType>
+template <typename Callback>
+constexpr void GraphCliques<T, IndexType>::forEachMaximalClique(
+    Callback &&onClique) const
+{
+    const auto graph = internal_cliqueAdjacency();
+    const internals::CliqueEnumerator<IndexType> enumerator(graph);
+
+    std::vector<std::vector<T>> names(enumerator.getNumberOfWorkers());
+    enumerator.forEachMaximalClique(
+        [&](size_t worker, std::span<const IndexType> clique) {
+            auto &cliqueNames = names[worker];
+            cliqueNames.clear();
+            for (const auto node : clique)
+            {
+                cliqueNames.emplace_back(
+                    this->getNodeMap().convertIndexToNodeName(node));
+            }
+            onClique(std::span<const T>(cliqueNames));
+        });
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::vector<T>> GraphCliques<T, IndexType>::
+    maximalCliques() const
+{
+    const auto graph = internal_cliqueAdjacency();
+    const internals::CliqueEnumerator<IndexType> enumerator(graph);
+
+    std::vector<std::vector<std::vector<IndexType>>> found(
+        enumerator.getNumberOfWorkers());
+    enumerator.forEachMaximalClique(
+        [&](size_t worker, std::span<const IndexType> clique) {
+            found[worker].emplace_back(clique.begin(), clique.end());
+        });
+
+    std::vector<std::vector<T>> result;
+    for (const auto &cliques : found)
+    {
+        for (const auto &clique : cliques)
+        {
+            result.emplace_back(
+                this->getNodeMap().convertIndexToNodeName(clique));
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphCliques<
+    T, IndexType>::internal_cliqueAdjacency() const
+{
+    auto graph = this->internal_compressNeighbors();
+    graph.sortAndDeduplicateRows(false);
+    return graph;
+}
+
+}; // namespace jGraph
@@ -0,0 +1,260 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "HyperLogLog.hpp"
+#include "NodeOrderings.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum ColoringOrder : std::uint8_t
+{
+    LARGEST_DEGREE_FIRST,
+    SMALLEST_LAST
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphColoring : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Proper coloring of the nodes, colors being numbered from 0. Nodes are
+    // colored greedily in the given order, Jones-Plassmann style: every
+    // round colors in parallel all the nodes whose predecessors in the order
+    // are colored. Smallest-last uses at most degeneracy + 1 colors.
+    [[nodiscard]] constexpr std::vector<std::pair<T, size_t>> greedyColoring(
+        ColoringOrder order = LARGEST_DEGREE_FIRST) const;
+
+    // Luby's algorithm, every round adds in parallel the nodes whose random
+    // priority beats the one of all their undecided neighbors
+    [[nodiscard]] constexpr std::vector<T> maximalIndependentSet(
+        uint64_t seed = 0) const;
+
+  private:
+    [[nodiscard]] constexpr std::vector<size_t> internal_greedyColoring(
+        ColoringOrder order) const;
+    [[nodiscard]] constexpr std::vector<bool> internal_maximalIndependentSet(
+        uint64_t seed) const;
+};
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, size_t>> GraphColoring<
+    T, IndexType>::greedyColoring(ColoringOrder order) const
+{
+    const auto colors = internal_greedyColoring(order);
+
+    std::vector<std::pair<T, size_t>> result;
+    result.reserve(colors.size());
+    for (size_t node = 0; node < colors.size(); node++)
+    {
+        result.emplace_back(this->getNodeMap().convertIndexToNodeName(
+                                static_cast<IndexType>(node)),
+                            colors[node]);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<T> GraphColoring<T, IndexType>::maximalIndependentSet(
+    uint64_t seed) const
+{
+    const auto inSet = internal_maximalIndependentSet(seed);
+
+    std::vector<T> result;
+    for (size_t node = 0; node < inSet.size(); node++)
+    {
+        if (inSet[node])
+        {
+            result.emplace_back(this->getNodeMap().convertIndexToNodeName(
+                static_cast<IndexType>(node)));
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<size_t> GraphColoring<
+    T, IndexType>::internal_greedyColoring(ColoringOrder order) const
+{
+    const auto graph = this->internal_compressNeighbors();
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    const auto nodeOrder = order == SMALLEST_LAST
+                               ? internals::smallestLastOrder(graph)
+                               : internals::largestDegreeFirstOrder(graph);
+
+    std::vector<size_t> ranks(numberOfNodes);
+    for (size_t rank = 0; rank < numberOfNodes; rank++)
+        ranks[static_cast<size_t>(nodeOrder[rank])] = rank;
+
+    // Number of neighbors placed before every node which are not colored yet
+    std::vector<std::atomic<size_t>> waiting(numberOfNodes);
+    std::vector<IndexType> frontier;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        size_t predecessors = 0;
+        for (const auto neighbor :
+             graph.getNeighbors(static_cast<IndexType>(node)))
+        {
+            if (ranks[static_cast<size_t>(neighbor)] < ranks[node])
+                predecessors++;
+        }
+        waiting[node].store(predecessors, std::memory_order_relaxed);
+        if (predecessors == 0)
+            frontier.emplace_back(static_cast<IndexType>(node));
+    }
+
+    const auto workers = internals::numberOfWorkers(numberOfNodes);
+    std::vector<std::vector<size_t>> usedColors(workers);
+    std::vector<std::vector<IndexType>> nextFrontiers(workers);
+    std::vector<size_t> colors(numberOfNodes, 0);
+    while (!frontier.empty())
+    {
+        // Only predecessors are read, they were colored in earlier rounds
+        internals::parallelFor(
+            frontier.size(),
+            [&](size_t worker, size_t position) {
+                const auto node = frontier[position];
+                const auto index = static_cast<size_t>(node);
+                auto &used = usedColors[worker];
+                used.clear();
+                for (const auto neighbor : graph.getNeighbors(node))
+                {
+                    const auto neighborIndex = static_cast<size_t>(neighbor);
+                    if (ranks[neighborIndex] < ranks[index])
+                        used.emplace_back(colors[neighborIndex]);
+                }
+                std::ranges::sort(used);
+
+                size_t color = 0;
+                for (const auto usedColor : used)
+                {
+                    if (usedColor == color)
+                        color++;
+                    else if (usedColor > color)
+                        break;
+                }
+                colors[index] = color;
+            },
+            64);
+
+        internals::parallelFor(
+            frontier.size(),
+            [&](size_t worker, size_t position) {
+                const auto node = frontier[position];
+                const auto rank = ranks[static_cast<size_t>(node)];
+                for (const auto neighbor : graph.getNeighbors(node))
+                {
+                    const auto index = static_cast<size_t>(neighbor);
+                    if (ranks[index] > rank &&
+                        waiting[index].fetch_sub(
+                            1, std::memory_order_relaxed) == 1)
+                        nextFrontiers[worker].emplace_back(neighbor);
+                }
+            },
+            64);
+
+        frontier.clear();
+        for (auto &nextFrontier : nextFrontiers)
+        {
+            frontier.insert(frontier.end(), nextFrontier.begin(),
+                            nextFrontier.end());
+            nextFrontier.clear();
+        }
+    }
+    return colors;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<bool> GraphColoring<
+    T, IndexType>::internal_maximalIndependentSet(uint64_t seed) const
+{
+    enum NodeState : std::uint8_t
+    {
+        UNDECIDED,
+        IN_SET,
+        OUT_OF_SET
+    };
+
+    const auto graph = this->internal_compressNeighbors();
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    const auto precedes = [seed](IndexType first, IndexType second) {
+        const auto firstPriority =
+            internals::mixHash(static_cast<uint64_t>(first), seed);
+        const auto secondPriority =
+            internals::mixHash(static_cast<uint64_t>(second), seed);
+        return firstPriority > secondPriority ||
+               (firstPriority == secondPriority && first < second);
+    };
+
+    // Bytes rather than bits, so that workers can write neighboring entries
+    std::vector<std::uint8_t> states(numberOfNodes, UNDECIDED);
+    std::vector<std::uint8_t> selected(numberOfNodes, 0);
+    std::vector<IndexType> undecided(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        undecided[node] = static_cast<IndexType>(node);
+
+    while (!undecided.empty())
+    {
+        internals::parallelFor(
+            undecided.size(),
+            [&](size_t, size_t position) {
+                const auto node = undecided[position];
+                bool isLocalMaximum = true;
+                for (const auto neighbor : graph.getNeighbors(node))
+                {
+                    if (neighbor != node &&
+                        states[static_cast<size_t>(neighbor)] == UNDECIDED &&
+                        precedes(neighbor, node))
+                    {
+                        isLocalMaximum = false;
+                        break;
+                    }
+                }
+                selected[static_cast<size_t>(node)] =
+                    static_cast<std::uint8_t>(isLocalMaximum);
+            },
+            256);
+
+        internals::parallelFor(
+            undecided.size(),
+            [&](size_t, size_t position) {
+                const auto node = undecided[position];
+                const auto index = static_cast<size_t>(node);
+                if (selected[index] != 0)
+                {
+                    states[index] = IN_SET;
+                    return;
+                }
+                for (const auto neighbor : graph.getNeighbors(node))
+                {
+                    if (selected[static_cast<size_t>(neighbor)] != 0)
+                    {
+                        states[index] = OUT_OF_SET;
+                        return;
+                    }
+                }
+            },
+            256);
+
+        std::erase_if(undecided, [&](IndexType node) {
+            return states[static_cast<size_t>(node)] != UNDECIDED;
+        });
+    }
+
+    std::vector<bool> inSet(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        inSet[node] = states[node] == IN_SET;
+    return inSet;
+}
+
+}; // namespace jGraph
@@ -0,0 +1,503 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "HyperLogLog.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum LabelPropagationOrder : std::uint8_t
+{
+    DEGREE_ORDER,
+    RANDOM_ORDER
+};
+
+template <typename T>
+struct communityDetectionResult
+{
+    // Community of every node, numbered from 0
+    std::vector<std::pair<T, size_t>> communities;
+    double modularity = 0;
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphCommunities : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Every node repeatedly adopts the label carrying the most edge weight
+    // among its neighbors. Sweeps run in parallel and update labels in
+    // place, visiting nodes by increasing degree or in a new random order
+    // each sweep, until no label changes.
+    [[nodiscard]] constexpr communityDetectionResult<T> labelPropagation(
+        LabelPropagationOrder order = DEGREE_ORDER, uint64_t seed = 0,
+        size_t maxSweeps = 100) const;
+
+    // Multi-level modularity optimization. Nodes are moved between
+    // communities while it improves modularity, communities that ended up
+    // disconnected are split as in Leiden, then every community is collapsed
+    // into a single node of a smaller graph and the process repeats.
+    [[nodiscard]] constexpr communityDetectionResult<T> louvain(
+        double resolution = 1) const;
+
+  private:
+    [[nodiscard]] constexpr communityDetectionResult<T>
+    internal_nameCommunities(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::vector<IndexType> &communities, double resolution) const;
+
+    [[nodiscard]] static constexpr double internal_arcWeight(
+        const internals::CompressedAdjacency<IndexType> &graph, IndexType node,
+        size_t neighborPosition);
+
+    // Renumbers communities from 0 in order of first appearance and returns
+    // their number
+    static constexpr size_t internal_compactCommunities(
+        std::vector<IndexType> &communities);
+
+    [[nodiscard]] static constexpr double internal_modularity(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::span<const IndexType> communities, size_t numberOfCommunities,
+        double resolution);
+
+    static constexpr bool internal_moveNodes(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::vector<IndexType> &communities, double resolution);
+
+    static constexpr size_t internal_splitDisconnected(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::vector<IndexType> &communities);
+
+    [[nodiscard]] static constexpr internals::CompressedAdjacency<IndexType>
+    internal_aggregate(const internals::CompressedAdjacency<IndexType> &graph,
+                       std::span<const IndexType> communities,
+                       size_t numberOfCommunities);
+};
+
+template <typename T, typename IndexType>
+constexpr communityDetectionResult<T> GraphCommunities<
+    T, IndexType>::labelPropagation(LabelPropagationOrder order, uint64_t seed,
+                                    size_t maxSweeps) const
+{
+    const auto graph = this->internal_compressUndirectedNeighbors();
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    std::vector<std::atomic<IndexType>> labels(numberOfNodes);
+    std::vector<IndexType> visitOrder(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        labels[node].store(static_cast<IndexType>(node),
+                           std::memory_order_relaxed);
+        visitOrder[node] = static_cast<IndexType>(node);
+    }
+    if (order == DEGREE_ORDER)
+    {
+        std::ranges::stable_sort(visitOrder, {}, [&](IndexType node) {
+            return graph.getDegree(node);
+        });
+    }
+
+    std::mt19937_64 generator(seed);
+    std::vector<std::vector<std::pair<IndexType, double>>> scratch(
+        internals::numberOfWorkers(numberOfNodes));
+
+    for (size_t sweep = 0; sweep < maxSweeps; sweep++)
+    {
+        if (order == RANDOM_ORDER)
+            std::ranges::shuffle(visitOrder, generator);
+
+        // Ties are broken by a hash that changes every sweep, so that no
+        // label is systematically favored
+        const auto tieSeed = seed + sweep;
+        std::atomic<size_t> changes = 0;
+        internals::parallelFor(
+            numberOfNodes,
+            [&](size_t worker, size_t position) {
+                const auto node = visitOrder[position];
+                const auto neighbors = graph.getNeighbors(node);
+                if (neighbors.empty())
+                    return;
+
+                auto &labelWeights = scratch[worker];
+                labelWeights.clear();
+                for (size_t j = 0; j < neighbors.size(); j++)
+                {
+                    labelWeights.emplace_back(
+                        labels[static_cast<size_t>(neighbors[j])].load(
+                            std::memory_order_relaxed),
+                        internal_arcWeight(graph, node, j));
+                }
+                std::ranges::sort(labelWeights);
+
+                const auto current = labels[static_cast<size_t>(node)].load(
+                    std::memory_order_relaxed);
+                auto best = current;
+                double bestWeight = 0;
+                for (size_t begin = 0; begin < labelWeights.size();)
+                {
+                    const auto label = labelWeights[begin].first;
+                    double weight = 0;
+                    for (; begin < labelWeights.size() &&
+                           labelWeights[begin].first == label;
+                         begin++)
+                        weight += labelWeights[begin].second;
+
+                    if (label == current)
+                    {
+                        if (weight >= bestWeight)
+                        {
+                            best = current;
+                            bestWeight = weight;
+                        }
+                    }
+                    else if (weight > bestWeight ||
+                             (weight == bestWeight && best != current &&
+                              internals::mixHash(
+                                  static_cast<uint64_t>(label), tieSeed) <
+                                  internals::mixHash(
+                                      static_cast<uint64_t>(best), tieSeed)))
+                    {
+                        best = label;
+                        bestWeight = weight;
+                    }
+                }
+
+                if (best != current)
+                {
+                    labels[static_cast<size_t>(node)].store(
+                        best, std::memory_order_relaxed);
+                    changes.fetch_add(1, std::memory_order_relaxed);
+                }
+            },
+            256);
+
+        if (changes.load() == 0)
+            break;
+    }
+
+    std::vector<IndexType> communities(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        communities[node] = labels[node].load(std::memory_order_relaxed);
+    return internal_nameCommunities(graph, communities, 1);
+}
+
+template <typename T, typename IndexType>
+constexpr communityDetectionResult<T> GraphCommunities<T, IndexType>::louvain(
+    double resolution) const
+{
+    const auto originalGraph = this->internal_compressUndirectedNeighbors();
+    const auto numberOfNodes = originalGraph.getNumberOfNodes();
+
+    // Node of the current level that every original node belongs to
+    std::vector<IndexType> membership(numberOfNodes);
+    std::iota(membership.begin(), membership.end(), IndexType{0});
+
+    auto graph = originalGraph;
+    std::vector<IndexType> communities;
+    while (true)
+    {
+        communities.resize(graph.getNumberOfNodes());
+        std::iota(communities.begin(), communities.end(), IndexType{0});
+        if (!internal_moveNodes(graph, communities, resolution))
+            break;
+
+        const auto numberOfCommunities =
+            internal_splitDisconnected(graph, communities);
+        for (auto &node : membership)
+            node = communities[static_cast<size_t>(node)];
+        if (numberOfCommunities == graph.getNumberOfNodes())
+            break;
+
+        graph = internal_aggregate(graph, communities, numberOfCommunities);
+    }
+    return internal_nameCommunities(originalGraph, membership, resolution);
+}
+
+template <typename T, typename IndexType>
+constexpr communityDetectionResult<T> GraphCommunities<
+    T, IndexType>::internal_nameCommunities(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::vector<IndexType> &communities, double resolution) const
+{
+    const auto numberOfCommunities = internal_compactCommunities(communities);
+
+    communityDetectionResult<T> result;
+    result.modularity = internal_modularity(graph, communities,
+                                            numberOfCommunities, resolution);
+    result.communities.reserve(communities.size());
+    for (size_t node = 0; node < communities.size(); node++)
+    {
+        result.communities.emplace_back(
+            this->getNodeMap().convertIndexToNodeName(
+                static_cast<IndexType>(node)),
+            static_cast<size_t>(communities[node]));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphCommunities<T, IndexType>::internal_arcWeight(
+    const internals::CompressedAdjacency<IndexType> &graph, IndexType node,
+    size_t neighborPosition)
+{
+    if (!graph.isWeighted())
+        return 1;
+    return graph.getWeights(node)[neighborPosition];
+}
+
+template <typename T, typename IndexType>
+constexpr size_t GraphCommunities<T, IndexType>::internal_compactCommunities(
+    std::vector<IndexType> &communities)
+{
+    constexpr auto unnumbered = std::numeric_limits<size_t>::max();
+    std::vector<size_t> numbers(communities.size(), unnumbered);
+    size_t numberOfCommunities = 0;
+    for (auto &community : communities)
+    {
+        auto &number = numbers[static_cast<size_t>(community)];
+        if (number == unnumbered)
+            number = numberOfCommunities++;
+        community = static_cast<IndexType>(number);
+    }
+    return numberOfCommunities;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphCommunities<T, IndexType>::internal_modularity(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::span<const IndexType> communities, size_t numberOfCommunities,
+    double resolution)
+{
+    std::vector<double> insideWeights(numberOfCommunities, 0);
+    std::vector<double> totalWeights(numberOfCommunities, 0);
+    double totalWeight = 0;
+    for (size_t i = 0; i < graph.getNumberOfNodes(); i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        const auto community = static_cast<size_t>(communities[i]);
+        const auto neighbors = graph.getNeighbors(node);
+        for (size_t j = 0; j < neighbors.size(); j++)
+        {
+            const auto weight = internal_arcWeight(graph, node, j);
+            totalWeights[community] += weight;
+            totalWeight += weight;
+            if (communities[static_cast<size_t>(neighbors[j])] ==
+                communities[i])
+                insideWeights[community] += weight;
+        }
+    }
+    if (totalWeight == 0)
+        return 0;
+
+    double modularity = 0;
+    for (size_t community = 0; community < numberOfCommunities; community++)
+    {
+        const auto share = totalWeights[community] / totalWeight;
+        modularity += (insideWeights[community] / totalWeight) -
+                      (resolution * share * share);
+    }
+    return modularity;
+}
+
+template <typename T, typename IndexType>
+constexpr bool GraphCommunities<T, IndexType>::internal_moveNodes(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::vector<IndexType> &communities, double resolution)
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    std::vector<double> nodeWeights(numberOfNodes, 0);
+    double totalWeight = 0;
+    for (size_t i = 0; i < numberOfNodes; i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        for (size_t j = 0; j < graph.getDegree(node); j++)
+            nodeWeights[i] += internal_arcWeight(graph, node, j);
+        totalWeight += nodeWeights[i];
+    }
+    if (totalWeight == 0)
+        return false;
+
+    // Weight of the arcs from the current node to every community, reset
+    // through the list of touched communities after each node
+    std::vector<double> communityWeights(nodeWeights);
+    std::vector<double> linkWeights(numberOfNodes, 0);
+    std::vector<IndexType> touched;
+    const auto minimumGain = totalWeight * 1e-12;
+
+    bool movedAny = false;
+    bool moved = true;
+    while (moved)
+    {
+        moved = false;
+        for (size_t i = 0; i < numberOfNodes; i++)
+        {
+            const auto node = static_cast<IndexType>(i);
+            const auto neighbors = graph.getNeighbors(node);
+            for (size_t j = 0; j < neighbors.size(); j++)
+            {
+                if (neighbors[j] == node)
+                    continue;
+                const auto community =
+                    communities[static_cast<size_t>(neighbors[j])];
+                auto &linkWeight = linkWeights[static_cast<size_t>(community)];
+                if (linkWeight == 0)
+                    touched.emplace_back(community);
+                linkWeight += internal_arcWeight(graph, node, j);
+            }
+
+            const auto current = communities[i];
+            const auto scaledWeight = resolution * nodeWeights[i] / totalWeight;
+            communityWeights[static_cast<size_t>(current)] -= nodeWeights[i];
+
+            auto best = current;
+            auto bestGain =
+                linkWeights[static_cast<size_t>(current)] -
+                (communityWeights[static_cast<size_t>(current)] * scaledWeight);
+            for (const auto community : touched)
+            {
+                const auto index = static_cast<size_t>(community);
+                const auto gain = linkWeights[index] -
+                                  (communityWeights[index] * scaledWeight);
+                if (gain > bestGain + minimumGain)
+                {
+                    best = community;
+                    bestGain = gain;
+                }
+            }
+
+            communityWeights[static_cast<size_t>(best)] += nodeWeights[i];
+            if (best != current)
+            {
+                communities[i] = best;
+                moved = true;
+                movedAny = true;
+            }
+
+            for (const auto community : touched)
+                linkWeights[static_cast<size_t>(community)] = 0;
+            touched.clear();
+        }
+    }
+    return movedAny;
+}
+
+template <typename T, typename IndexType>
+constexpr size_t GraphCommunities<T, IndexType>::internal_splitDisconnected(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::vector<IndexType> &communities)
+{
+    // Splitting a disconnected community never lowers modularity, since no
+    // edge links its parts while the squared total weight shrinks
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    constexpr auto unassigned = std::numeric_limits<size_t>::max();
+    std::vector<size_t> parts(numberOfNodes, unassigned);
+    std::vector<IndexType> stack;
+    size_t numberOfParts = 0;
+
+    for (size_t root = 0; root < numberOfNodes; root++)
+    {
+        if (parts[root] != unassigned)
+            continue;
+
+        parts[root] = numberOfParts;
+        stack.emplace_back(static_cast<IndexType>(root));
+        while (!stack.empty())
+        {
+            const auto node = stack.back();
+            stack.pop_back();
+            for (const auto neighbor : graph.getNeighbors(node))
+            {
+                const auto index = static_cast<size_t>(neighbor);
+                if (parts[index] == unassigned &&
+                    communities[index] == communities[root])
+                {
+                    parts[index] = numberOfParts;
+                    stack.emplace_back(neighbor);
+                }
+            }
+        }
+        numberOfParts++;
+    }
+
+    for (size_t node = 0; node < numberOfNodes; node++)
+        communities[node] = static_cast<IndexType>(parts[node]);
+    return numberOfParts;
+}
+
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphCommunities<
+    T, IndexType>::internal_aggregate(const internals::CompressedAdjacency<
+                                          IndexType> &graph,
+                                      std::span<const IndexType> communities,
+                                      size_t numberOfCommunities)
+{
+    // Group nodes by community with a counting sort
+    std::vector<size_t> memberOffsets(numberOfCommunities + 1, 0);
+    for (const auto community : communities)
+        memberOffsets[static_cast<size_t>(community) + 1]++;
+    std::partial_sum(memberOffsets.begin(), memberOffsets.end(),
+                     memberOffsets.begin());
+
+    std::vector<IndexType> members(communities.size());
+    std::vector<size_t> nextMember(memberOffsets.begin(),
+                                   memberOffsets.end() - 1);
+    for (size_t node = 0; node < communities.size(); node++)
+    {
+        members[nextMember[static_cast<size_t>(communities[node])]++] =
+            static_cast<IndexType>(node);
+    }
+
+    // Arcs between two communities merge into one arc, arcs inside a
+    // community into a self loop, which keeps every node weight unchanged
+    internals::CompressedAdjacency<IndexType> result(numberOfCommunities);
+    std::vector<double> linkWeights(numberOfCommunities, 0);
+    std::vector<bool> linked(numberOfCommunities, false);
+    std::vector<IndexType> touched;
+    for (size_t community = 0; community < numberOfCommunities; community++)
+    {
+        for (auto member = memberOffsets[community];
+             member < memberOffsets[community + 1]; member++)
+        {
+            const auto node = members[member];
+            const auto neighbors = graph.getNeighbors(node);
+            for (size_t j = 0; j < neighbors.size(); j++)
+            {
+                const auto target = static_cast<size_t>(
+                    communities[static_cast<size_t>(neighbors[j])]);
+                if (!linked[target])
+                {
+                    linked[target] = true;
+                    touched.emplace_back(static_cast<IndexType>(target));
+                }
+                linkWeights[target] += internal_arcWeight(graph, node, j);
+            }
+        }
+
+        for (const auto target : touched)
+        {
+            const auto index = static_cast<size_t>(target);
+            result.appendNeighbor(target, linkWeights[index]);
+            linkWeights[index] = 0;
+            linked[index] = false;
+        }
+        touched.clear();
+        result.closeRow();
+    }
+    return result;
+}
+
+}; // namespace jGraph
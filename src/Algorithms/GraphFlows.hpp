@@ -0,0 +1,222 @@
+#pragma once
+
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "MaximumFlowEngine.hpp"
+#include "MinimumCutEngine.hpp"
+
+#include <cstddef>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum MaximumFlowAlgorithm : std::uint8_t
+{
+    PUSH_RELABEL,
+    DINIC
+};
+
+enum MinimumCutAlgorithm : std::uint8_t
+{
+    STOER_WAGNER,
+    KARGER_STEIN
+};
+
+template <typename T>
+struct minimumCutResult
+{
+    // Infinity for graphs with fewer than 2 nodes, which have no cut
+    double weight = std::numeric_limits<double>::infinity();
+    std::vector<T> firstSide;
+    std::vector<T> secondSide;
+};
+
+template <typename T>
+struct maximumFlowResult
+{
+    double value = 0;
+    // Both sides of a minimum cut, the source being on the first one
+    std::vector<T> sourceSide;
+    std::vector<T> sinkSide;
+    // (from, to, flow) for every edge carrying flow
+    std::vector<std::tuple<T, T, double>> edgeFlows;
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphFlows : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Maximum flow from source to sink, using edge weights as capacities.
+    // Edges of undirected graphs carry flow both ways and unweighted graphs
+    // give every edge a capacity of 1. Push-relabel is a good default, Dinic
+    // is faster on unit capacity graphs.
+    [[nodiscard]] constexpr maximumFlowResult<T> maximumFlow(
+        std::pair<T, T> sourceAndSink,
+        MaximumFlowAlgorithm algorithm = PUSH_RELABEL) const;
+
+    // Minimum weight set of edges splitting the graph in two, edge
+    // directions being ignored and unweighted edges weighing 1. Weights must
+    // not be negative. Stoer-Wagner is exact, in O(VE + V^2 log(V)).
+    // Karger-Stein is randomized, finding a minimum cut with high
+    // probability, and runs its trials in parallel. Without a number of
+    // trials, log2(V)^2 of them are run.
+    [[nodiscard]] constexpr minimumCutResult<T> globalMinimumCut(
+        MinimumCutAlgorithm algorithm = STOER_WAGNER, size_t trials = 0,
+        uint64_t seed = 0) const;
+
+  private:
+    [[nodiscard]] constexpr std::vector<internals::FlowEdge<IndexType>>
+    internal_flowEdges() const;
+    [[nodiscard]] constexpr std::vector<internals::CutEdge<IndexType>>
+    internal_cutEdges() const;
+};
+
+template <typename T, typename IndexType>
+constexpr maximumFlowResult<T> GraphFlows<T, IndexType>::maximumFlow(
+    std::pair<T, T> sourceAndSink, MaximumFlowAlgorithm algorithm) const
+{
+    const auto source =
+        this->getNodeMap().convertNodeNameToIndex(sourceAndSink.first);
+    const auto sink =
+        this->getNodeMap().convertNodeNameToIndex(sourceAndSink.second);
+
+    const auto edges = internal_flowEdges();
+    internals::ResidualNetwork<IndexType> network(this->getNumberOfNodes(),
+                                                  edges);
+
+    maximumFlowResult<T> result;
+    if (algorithm == DINIC)
+        result.value = internals::Dinic<IndexType>(network).run(source, sink);
+    else
+        result.value =
+            internals::PushRelabel<IndexType>(network).run(source, sink);
+
+    const auto sourceSide = network.getResidualReachable(source);
+    for (size_t node = 0; node < sourceSide.size(); node++)
+    {
+        auto name = this->getNodeMap().convertIndexToNodeName(
+            static_cast<IndexType>(node));
+        if (sourceSide[node])
+            result.sourceSide.emplace_back(std::move(name));
+        else
+            result.sinkSide.emplace_back(std::move(name));
+    }
+
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+        const auto flow = network.getEdgeFlow(i);
+        const auto from = this->getNodeMap().convertIndexToNodeName(
+            edges[i].from);
+        const auto to =
+            this->getNodeMap().convertIndexToNodeName(edges[i].to);
+        if (flow > 0)
+            result.edgeFlows.emplace_back(from, to, flow);
+        else if (flow < 0)
+            result.edgeFlows.emplace_back(to, from, -flow);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<internals::FlowEdge<IndexType>> GraphFlows<
+    T, IndexType>::internal_flowEdges() const
+{
+    const auto graph =
+        this->internal_compressOutgoingNeighbors(this->isWeighted());
+    const bool directed = this->isDirected();
+
+    std::vector<internals::FlowEdge<IndexType>> edges;
+    edges.reserve(directed ? graph.getNumberOfArcs()
+                           : graph.getNumberOfArcs() / 2);
+    for (size_t i = 0; i < graph.getNumberOfNodes(); i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        const auto neighbors = graph.getNeighbors(node);
+        const auto weights = graph.getWeights(node);
+        for (size_t j = 0; j < neighbors.size(); j++)
+        {
+            // Undirected edges are listed from both ends, keep one of them
+            if (neighbors[j] == node || (!directed && neighbors[j] < node))
+                continue;
+
+            const double capacity = weights.empty() ? 1 : weights[j];
+            edges.emplace_back(node, neighbors[j], capacity,
+                               directed ? 0 : capacity);
+        }
+    }
+    return edges;
+}
+
+template <typename T, typename IndexType>
+constexpr minimumCutResult<T> GraphFlows<T, IndexType>::globalMinimumCut(
+    MinimumCutAlgorithm algorithm, size_t trials, uint64_t seed) const
+{
+    const auto numberOfNodes = this->getNumberOfNodes();
+    minimumCutResult<T> result;
+    if (numberOfNodes < 2)
+    {
+        result.firstSide = this->getNodes();
+        return result;
+    }
+
+    const auto edges = internal_cutEdges();
+    auto cut = internals::disconnectedCut<IndexType>(numberOfNodes, edges);
+    if (!cut && algorithm == KARGER_STEIN)
+    {
+        if (trials == 0)
+        {
+            const auto logarithm = static_cast<size_t>(
+                std::bit_width(numberOfNodes - 1));
+            trials = logarithm * logarithm;
+        }
+        cut = internals::kargerStein<IndexType>(numberOfNodes, edges, trials,
+                                                seed);
+    }
+    else if (!cut)
+        cut = internals::stoerWagner<IndexType>(numberOfNodes, edges);
+
+    result.weight = cut->weight;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        auto name = this->getNodeMap().convertIndexToNodeName(
+            static_cast<IndexType>(node));
+        if (cut->firstSide[node])
+            result.firstSide.emplace_back(std::move(name));
+        else
+            result.secondSide.emplace_back(std::move(name));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<internals::CutEdge<IndexType>> GraphFlows<
+    T, IndexType>::internal_cutEdges() const
+{
+    const auto graph = this->internal_compressUndirectedNeighbors();
+
+    std::vector<internals::CutEdge<IndexType>> edges;
+    edges.reserve(graph.getNumberOfArcs() / 2);
+    for (size_t i = 0; i < graph.getNumberOfNodes(); i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        const auto neighbors = graph.getNeighbors(node);
+        const auto weights = graph.getWeights(node);
+        for (size_t j = 0; j < neighbors.size(); j++)
+        {
+            // Edges are listed from both ends, keep one of them
+            if (neighbors[j] <= node)
+                continue;
+            edges.emplace_back(node, neighbors[j],
+                               weights.empty() ? 1 : weights[j]);
+        }
+    }
+    return edges;
+}
+
+}; // namespace jGraph
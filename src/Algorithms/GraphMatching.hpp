@@ -0,0 +1,350 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum MatchingAlgorithm : std::uint8_t
+{
+    HOPCROFT_KARP,
+    PARALLEL_PUSH_RELABEL
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphMatching : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    [[nodiscard]] constexpr bool isBipartite() const;
+
+    // Both sides of a two-coloring of the nodes, if there is one. Edge
+    // directions are ignored.
+    [[nodiscard]] constexpr std::optional<
+        std::pair<std::vector<T>, std::vector<T>>>
+    bipartition() const;
+
+    // Maximum matching of a bipartite graph, as pairs whose first node is on
+    // the first side of bipartition(). Empty if the graph is not bipartite.
+    // The parallel variant builds most of the matching with concurrent
+    // push-relabel steps and lets Hopcroft-Karp finish the few remaining
+    // augmenting paths.
+    [[nodiscard]] constexpr std::vector<std::pair<T, T>> maximumMatching(
+        MatchingAlgorithm algorithm = HOPCROFT_KARP) const;
+
+  private:
+    static constexpr size_t UNMATCHED = std::numeric_limits<size_t>::max();
+
+    // Side of every node, 0 or 1
+    [[nodiscard]] static constexpr std::optional<std::vector<std::uint8_t>>
+    internal_bipartition(
+        const internals::CompressedAdjacency<IndexType> &graph);
+
+    static constexpr void internal_hopcroftKarp(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::span<const std::uint8_t> sides, std::vector<size_t> &mates);
+
+    static constexpr void internal_pushRelabelMatching(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::span<const std::uint8_t> sides, std::vector<size_t> &mates);
+};
+
+template <typename T, typename IndexType>
+constexpr bool GraphMatching<T, IndexType>::isBipartite() const
+{
+    return internal_bipartition(this->internal_compressNeighbors())
+        .has_value();
+}
+
+template <typename T, typename IndexType>
+constexpr std::optional<std::pair<std::vector<T>, std::vector<T>>>
+GraphMatching<T, IndexType>::bipartition() const
+{
+    const auto sides = internal_bipartition(this->internal_compressNeighbors());
+    if (!sides)
+        return std::nullopt;
+
+    std::pair<std::vector<T>, std::vector<T>> result;
+    for (size_t node = 0; node < sides->size(); node++)
+    {
+        auto name = this->getNodeMap().convertIndexToNodeName(
+            static_cast<IndexType>(node));
+        if ((*sides)[node] == 0)
+            result.first.emplace_back(std::move(name));
+        else
+            result.second.emplace_back(std::move(name));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, T>> GraphMatching<
+    T, IndexType>::maximumMatching(MatchingAlgorithm algorithm) const
+{
+    const auto graph = this->internal_compressNeighbors();
+    const auto sides = internal_bipartition(graph);
+    if (!sides)
+        return {};
+
+    std::vector<size_t> mates(graph.getNumberOfNodes(), UNMATCHED);
+    if (algorithm == PARALLEL_PUSH_RELABEL)
+        internal_pushRelabelMatching(graph, *sides, mates);
+    internal_hopcroftKarp(graph, *sides, mates);
+
+    std::vector<std::pair<T, T>> result;
+    for (size_t node = 0; node < mates.size(); node++)
+    {
+        if ((*sides)[node] == 0 && mates[node] != UNMATCHED)
+        {
+            result.emplace_back(this->getNodeMap().convertIndexToNodeName(
+                                    static_cast<IndexType>(node)),
+                                this->getNodeMap().convertIndexToNodeName(
+                                    static_cast<IndexType>(mates[node])));
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::optional<std::vector<std::uint8_t>> GraphMatching<
+    T, IndexType>::internal_bipartition(const internals::CompressedAdjacency<
+                                        IndexType> &graph)
+{
+    constexpr std::uint8_t uncolored = 2;
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    std::vector<std::uint8_t> sides(numberOfNodes, uncolored);
+    std::vector<IndexType> queue;
+    queue.reserve(numberOfNodes);
+
+    for (size_t root = 0; root < numberOfNodes; root++)
+    {
+        if (sides[root] != uncolored)
+            continue;
+
+        sides[root] = 0;
+        queue.clear();
+        queue.emplace_back(static_cast<IndexType>(root));
+        for (size_t next = 0; next < queue.size(); next++)
+        {
+            const auto node = queue[next];
+            const auto side = sides[static_cast<size_t>(node)];
+            for (const auto neighbor : graph.getNeighbors(node))
+            {
+                auto &neighborSide = sides[static_cast<size_t>(neighbor)];
+                if (neighborSide == side)
+                    return std::nullopt;
+                if (neighborSide == uncolored)
+                {
+                    neighborSide = static_cast<std::uint8_t>(1 - side);
+                    queue.emplace_back(neighbor);
+                }
+            }
+        }
+    }
+    return sides;
+}
+
+template <typename T, typename IndexType>
+constexpr void GraphMatching<T, IndexType>::internal_hopcroftKarp(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::span<const std::uint8_t> sides, std::vector<size_t> &mates)
+{
+    constexpr auto unreached = std::numeric_limits<size_t>::max();
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    std::vector<size_t> layers(numberOfNodes, unreached);
+    std::vector<size_t> nextNeighbor(numberOfNodes, 0);
+    std::vector<IndexType> queue;
+    std::vector<IndexType> stack;
+    std::vector<IndexType> via;
+
+    while (true)
+    {
+        // Layers of the left nodes along alternating paths starting from the
+        // free ones
+        std::ranges::fill(layers, unreached);
+        queue.clear();
+        for (size_t node = 0; node < numberOfNodes; node++)
+        {
+            if (sides[node] == 0 && mates[node] == UNMATCHED)
+            {
+                layers[node] = 0;
+                queue.emplace_back(static_cast<IndexType>(node));
+            }
+        }
+
+        bool foundFreeRight = false;
+        for (size_t next = 0; next < queue.size(); next++)
+        {
+            const auto left = queue[next];
+            for (const auto right : graph.getNeighbors(left))
+            {
+                const auto mate = mates[static_cast<size_t>(right)];
+                if (mate == UNMATCHED)
+                    foundFreeRight = true;
+                else if (layers[mate] == unreached)
+                {
+                    layers[mate] = layers[static_cast<size_t>(left)] + 1;
+                    queue.emplace_back(static_cast<IndexType>(mate));
+                }
+            }
+        }
+        if (!foundFreeRight)
+            break;
+
+        // Vertex disjoint augmenting paths along the layers, found by depth
+        // first searches kept on an explicit stack
+        std::ranges::fill(nextNeighbor, 0);
+        for (size_t root = 0; root < numberOfNodes; root++)
+        {
+            if (sides[root] != 0 || mates[root] != UNMATCHED)
+                continue;
+
+            stack.assign(1, static_cast<IndexType>(root));
+            via.clear();
+            while (!stack.empty())
+            {
+                const auto left = stack.back();
+                const auto leftIndex = static_cast<size_t>(left);
+                const auto neighbors = graph.getNeighbors(left);
+                if (nextNeighbor[leftIndex] == neighbors.size())
+                {
+                    layers[leftIndex] = unreached;
+                    stack.pop_back();
+                    if (!via.empty())
+                        via.pop_back();
+                    continue;
+                }
+
+                const auto right = neighbors[nextNeighbor[leftIndex]++];
+                const auto mate = mates[static_cast<size_t>(right)];
+                if (mate == UNMATCHED)
+                {
+                    // Flip the path, every left node takes the right node
+                    // that led to the next one
+                    auto taken = right;
+                    for (size_t level = stack.size(); level-- > 0;)
+                    {
+                        const auto pathLeft = static_cast<size_t>(stack[level]);
+                        const auto previousMate = level > 0 ? via[level - 1]
+                                                            : IndexType{};
+                        mates[pathLeft] = static_cast<size_t>(taken);
+                        mates[static_cast<size_t>(taken)] = pathLeft;
+                        taken = previousMate;
+                    }
+                    break;
+                }
+                if (layers[mate] == layers[leftIndex] + 1)
+                {
+                    via.emplace_back(right);
+                    stack.emplace_back(static_cast<IndexType>(mate));
+                }
+            }
+        }
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr void GraphMatching<T, IndexType>::internal_pushRelabelMatching(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    std::span<const std::uint8_t> sides, std::vector<size_t> &mates)
+{
+    // Every free left node takes the right neighbor of smallest label and
+    // evicts its mate, which becomes free in turn (a double push). The label
+    // of the taken node becomes the second smallest label plus two, so that
+    // labels stay lower bounds on the distance to a free right node. Right
+    // nodes are claimed with an atomic exchange and labels only grow, stale
+    // reads of them only cost extra pushes. Rounds are capped since
+    // Hopcroft-Karp completes whatever matching is left.
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    const auto labelLimit = numberOfNodes;
+
+    std::vector<std::atomic<size_t>> rightMates(numberOfNodes);
+    std::vector<std::atomic<size_t>> labels(numberOfNodes);
+    std::vector<IndexType> active;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        rightMates[node].store(UNMATCHED, std::memory_order_relaxed);
+        labels[node].store(0, std::memory_order_relaxed);
+        if (sides[node] == 0 &&
+            graph.getDegree(static_cast<IndexType>(node)) != 0)
+            active.emplace_back(static_cast<IndexType>(node));
+    }
+
+    std::vector<std::vector<IndexType>> evicted(
+        internals::numberOfWorkers(numberOfNodes));
+    for (size_t round = 0; round < labelLimit && !active.empty(); round++)
+    {
+        internals::parallelFor(
+            active.size(),
+            [&](size_t worker, size_t position) {
+                const auto left = active[position];
+                size_t smallest = labelLimit;
+                size_t secondSmallest = labelLimit;
+                std::optional<IndexType> chosen;
+                for (const auto right : graph.getNeighbors(left))
+                {
+                    const auto label = labels[static_cast<size_t>(right)].load(
+                        std::memory_order_relaxed);
+                    if (label < smallest)
+                    {
+                        secondSmallest = smallest;
+                        smallest = label;
+                        chosen = right;
+                    }
+                    else if (label < secondSmallest)
+                        secondSmallest = label;
+                }
+                if (!chosen)
+                    return;
+
+                const auto rightIndex = static_cast<size_t>(chosen.value());
+                const auto newLabel = std::min(secondSmallest + 2, labelLimit);
+                auto label = labels[rightIndex].load(std::memory_order_relaxed);
+                while (label < newLabel &&
+                       !labels[rightIndex].compare_exchange_weak(
+                           label, newLabel, std::memory_order_relaxed))
+                {
+                }
+                const auto previousMate = rightMates[rightIndex].exchange(
+                    static_cast<size_t>(left), std::memory_order_acq_rel);
+                if (previousMate != UNMATCHED)
+                {
+                    evicted[worker].emplace_back(
+                        static_cast<IndexType>(previousMate));
+                }
+            },
+            256);
+
+        active.clear();
+        for (auto &nodes : evicted)
+        {
+            active.insert(active.end(), nodes.begin(), nodes.end());
+            nodes.clear();
+        }
+    }
+
+    for (size_t right = 0; right < numberOfNodes; right++)
+    {
+        const auto left = rightMates[right].load(std::memory_order_relaxed);
+        if (left != UNMATCHED)
+        {
+            mates[right] = left;
+            mates[left] = right;
+        }
+    }
+}
+
+}; // namespace jGraph
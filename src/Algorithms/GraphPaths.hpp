@@ -0,0 +1,273 @@
+#pragma once
+
+#include "AllPairsShortestPaths.hpp"
+#include "BellmanFordEngine.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "KShortestPathsEngine.hpp"
+#include "NameIndexMap.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum AllPairsShortestPathsAlgorithm : std::uint8_t
+{
+    FLOYD_WARSHALL,
+    JOHNSON
+};
+
+enum NegativeWeightsAlgorithm : std::uint8_t
+{
+    BELLMAN_FORD,
+    SPFA,
+    PARALLEL_BELLMAN_FORD
+};
+
+template <typename T>
+struct singleSourceShortestPathsResult
+{
+    // Reached nodes with their distance from the source
+    std::vector<std::pair<T, double>> distances;
+    // Arcs of a shortest path tree as (previous node, node), like djikstra
+    std::vector<std::pair<T, T>> shortestPathTree;
+    // Negative cycle reachable from the source in the order of its arcs. The
+    // other members are left empty when there is one.
+    std::vector<T> negativeCycle;
+};
+
+template <typename T>
+struct allPairsShortestPathsResult
+{
+    // Row and column order of the matrices
+    std::vector<T> nodes;
+    // Row-major, infinity between nodes that cannot reach each other
+    std::vector<double> distances;
+    // Row-major position of the node following the row node on a shortest
+    // path to the column node. Only filled when paths are requested.
+    std::vector<size_t> nextNodes;
+    // Distances are meaningless if a negative cycle was found
+    bool hasNegativeCycle = false;
+
+    // Shortest path between the nodes at both positions, empty if there is
+    // none. Needs the next nodes and no negative cycle.
+    [[nodiscard]] constexpr std::vector<T> getPath(size_t from,
+                                                   size_t to) const;
+};
+
+// Lazy sequence of the loopless paths between two nodes, by non decreasing
+// length. Every call to next() only does the work needed for one more path,
+// so callers can stop after the first few. It reads the graph as it was when
+// the sequence was created, but names nodes through the graph, which must
+// outlive it.
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class PathGenerator
+{
+  public:
+    constexpr PathGenerator(
+        const internals::NameIndexMap<T, IndexType> &nodeMap,
+        internals::KShortestPathsEngine<IndexType> engine);
+
+    [[nodiscard]] constexpr std::optional<weightedPath<T>> next();
+
+  private:
+    const internals::NameIndexMap<T, IndexType> *nodeMap;
+    internals::KShortestPathsEngine<IndexType> engine;
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphPaths : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Yen's k shortest loopless paths, following edge directions and weights.
+    // Unweighted edges weigh 1, weights must not be negative.
+    [[nodiscard]] constexpr PathGenerator<T, IndexType> shortestPaths(
+        std::pair<T, T> pathExtremities) const;
+
+    // The k first paths of shortestPaths, fewer if there are not that many
+    [[nodiscard]] constexpr std::vector<weightedPath<T>> kShortestPaths(
+        std::pair<T, T> pathExtremities, size_t k) const;
+
+    // Distances between all pairs of nodes, following edge directions and
+    // weights, negative ones included. Floyd-Warshall suits dense graphs,
+    // Johnson runs a djikstra per node and suits sparse ones.
+    [[nodiscard]] constexpr allPairsShortestPathsResult<T>
+    allPairsShortestPaths(
+        AllPairsShortestPathsAlgorithm algorithm = FLOYD_WARSHALL,
+        bool withPaths = false) const;
+
+    // Shortest paths from a node, following edge directions and weights,
+    // which may be negative. Undirected edges with negative weights are
+    // negative cycles. SPFA is usually fastest, the parallel rounds suit
+    // large graphs with few arcs on their shortest paths.
+    [[nodiscard]] constexpr singleSourceShortestPathsResult<T> bellmanFord(
+        T source, NegativeWeightsAlgorithm algorithm = SPFA) const;
+
+    // Any negative cycle of the graph in the order of its arcs, empty if
+    // there is none
+    [[nodiscard]] constexpr std::vector<T> negativeCycle() const;
+};
+
+template <typename T>
+constexpr std::vector<T> allPairsShortestPathsResult<T>::getPath(
+    size_t from, size_t to) const
+{
+    const auto numberOfNodes = nodes.size();
+    if (nextNodes.empty() ||
+        nextNodes[(from * numberOfNodes) + to] == internals::NO_NEXT_NODE)
+        return {};
+
+    std::vector<T> path{nodes[from]};
+    for (auto node = from; node != to;)
+    {
+        node = nextNodes[(node * numberOfNodes) + to];
+        path.emplace_back(nodes[node]);
+    }
+    return path;
+}
+
+template <typename T, typename IndexType>
+constexpr PathGenerator<T, IndexType>::PathGenerator(
+    const internals::NameIndexMap<T, IndexType> &names,
+    internals::KShortestPathsEngine<IndexType> pathsEngine)
+    : nodeMap(&names), engine(std::move(pathsEngine))
+{
+}
+
+template <typename T, typename IndexType>
+constexpr std::optional<weightedPath<T>> PathGenerator<T, IndexType>::next()
+{
+    auto path = engine.next();
+    if (!path)
+        return std::nullopt;
+    return weightedPath<T>{nodeMap->convertIndexToNodeName(path->nodes),
+                           path->length};
+}
+
+template <typename T, typename IndexType>
+constexpr PathGenerator<T, IndexType> GraphPaths<T, IndexType>::shortestPaths(
+    std::pair<T, T> pathExtremities) const
+{
+    const auto source =
+        this->getNodeMap().convertNodeNameToIndex(pathExtremities.first);
+    const auto target =
+        this->getNodeMap().convertNodeNameToIndex(pathExtremities.second);
+    return PathGenerator<T, IndexType>(
+        this->getNodeMap(),
+        internals::KShortestPathsEngine<IndexType>(
+            this->internal_compressOutgoingNeighbors(true), source, target));
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<weightedPath<T>> GraphPaths<T, IndexType>::kShortestPaths(
+    std::pair<T, T> pathExtremities, size_t k) const
+{
+    auto generator = shortestPaths(std::move(pathExtremities));
+
+    std::vector<weightedPath<T>> result;
+    while (result.size() < k)
+    {
+        auto path = generator.next();
+        if (!path)
+            break;
+        result.emplace_back(std::move(path.value()));
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr allPairsShortestPathsResult<T> GraphPaths<
+    T, IndexType>::allPairsShortestPaths(AllPairsShortestPathsAlgorithm
+                                             algorithm,
+                                         bool withPaths) const
+{
+    const auto graph = this->internal_compressOutgoingNeighbors(true);
+    auto matrix = algorithm == JOHNSON
+                      ? internals::johnson(graph, withPaths)
+                      : internals::floydWarshall(graph, withPaths);
+
+    allPairsShortestPathsResult<T> result;
+    result.nodes.reserve(matrix.numberOfNodes);
+    for (size_t node = 0; node < matrix.numberOfNodes; node++)
+    {
+        result.nodes.emplace_back(this->getNodeMap().convertIndexToNodeName(
+            static_cast<IndexType>(node)));
+    }
+    result.distances = std::move(matrix.distances);
+    result.nextNodes = std::move(matrix.nextNodes);
+    result.hasNegativeCycle = matrix.hasNegativeCycle;
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr singleSourceShortestPathsResult<T> GraphPaths<
+    T, IndexType>::bellmanFord(T source,
+                               NegativeWeightsAlgorithm algorithm) const
+{
+    const auto graph = this->internal_compressOutgoingNeighbors(true);
+    internals::BellmanFordEngine<IndexType> engine(graph);
+    const std::array<IndexType, 1> sources{
+        this->getNodeMap().convertNodeNameToIndex(source)};
+
+    bool succeeded = false;
+    if (algorithm == BELLMAN_FORD)
+        succeeded = engine.bellmanFord(sources);
+    else if (algorithm == PARALLEL_BELLMAN_FORD)
+        succeeded = engine.parallelBellmanFord(sources);
+    else
+        succeeded = engine.spfa(sources);
+
+    singleSourceShortestPathsResult<T> result;
+    if (!succeeded)
+    {
+        for (const auto node : engine.getNegativeCycle())
+        {
+            result.negativeCycle.emplace_back(
+                this->getNodeMap().convertIndexToNodeName(node));
+        }
+        return result;
+    }
+
+    for (size_t node = 0; node < graph.getNumberOfNodes(); node++)
+    {
+        const auto index = static_cast<IndexType>(node);
+        if (!engine.isReached(index))
+            continue;
+
+        const auto name = this->getNodeMap().convertIndexToNodeName(index);
+        result.distances.emplace_back(name, engine.getDistance(index));
+        if (const auto parent = engine.getParent(index))
+        {
+            result.shortestPathTree.emplace_back(
+                this->getNodeMap().convertIndexToNodeName(parent.value()),
+                name);
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<T> GraphPaths<T, IndexType>::negativeCycle() const
+{
+    const auto graph = this->internal_compressOutgoingNeighbors(true);
+    std::vector<IndexType> sources(graph.getNumberOfNodes());
+    for (size_t node = 0; node < sources.size(); node++)
+        sources[node] = static_cast<IndexType>(node);
+
+    internals::BellmanFordEngine<IndexType> engine(graph);
+    if (engine.spfa(sources))
+        return {};
+
+    std::vector<T> result;
+    for (const auto node : engine.getNegativeCycle())
+        result.emplace_back(this->getNodeMap().convertIndexToNodeName(node));
+    return result;
+}
+
+}; // namespace jGraph
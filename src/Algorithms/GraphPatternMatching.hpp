@@ -0,0 +1,123 @@
+#pragma once
+
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "SubgraphMatcher.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace jGraph
+{
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphPatternMatching : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Number of injective mappings of the pattern nodes to the graph nodes
+    // that send every pattern edge to an edge, and every pattern non-edge to
+    // a non-edge when induced. Symmetric images are counted once per
+    // automorphism of the pattern. Edge directions are ignored.
+    template <typename PatternT, typename PatternIndexType>
+    [[nodiscard]] constexpr size_t countSubgraphEmbeddings(
+        const GraphPrimitives<PatternT, PatternIndexType> &pattern,
+        bool induced = false) const;
+
+    // The mappings counted above, entry i of every mapping being the image
+    // of the i-th node of pattern.getNodes()
+    template <typename PatternT, typename PatternIndexType>
+    [[nodiscard]] constexpr std::vector<std::vector<T>> subgraphEmbeddings(
+        const GraphPrimitives<PatternT, PatternIndexType> &pattern,
+        bool induced = false) const;
+
+  private:
+    template <typename PatternT, typename PatternIndexType>
+    [[nodiscard]] static constexpr internals::PatternAdjacency
+    internal_patternAdjacency(
+        const GraphPrimitives<PatternT, PatternIndexType> &pattern);
+
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_sortedNeighbors() const;
+};
+
+template <typename T, typename IndexType>
+template <typename PatternT, typename PatternIndexType>
+constexpr size_t GraphPatternMatching<T, IndexType>::countSubgraphEmbeddings(
+    const GraphPrimitives<PatternT, PatternIndexType> &pattern,
+    bool induced) const
+{
+    const auto graph = internal_sortedNeighbors();
+    const internals::SubgraphMatcher<IndexType> matcher(
+        graph, internal_patternAdjacency(pattern), induced);
+
+    std::vector<size_t> counts(matcher.getNumberOfWorkers(), 0);
+    matcher.forEachEmbedding(
+        [&](size_t worker, std::span<const IndexType>) { counts[worker]++; });
+    return std::accumulate(counts.begin(), counts.end(), size_t{0});
+}
+
+template <typename T, typename IndexType>
+template <typename PatternT, typename PatternIndexType>
+constexpr std::vector<std::vector<T>> GraphPatternMatching<
+    T, IndexType>::subgraphEmbeddings(const GraphPrimitives<PatternT,
+                                                            PatternIndexType>
+                                          &pattern,
+                                      bool induced) const
+{
+    const auto graph = internal_sortedNeighbors();
+    const internals::SubgraphMatcher<IndexType> matcher(
+        graph, internal_patternAdjacency(pattern), induced);
+
+    std::vector<std::vector<std::vector<IndexType>>> found(
+        matcher.getNumberOfWorkers());
+    matcher.forEachEmbedding(
+        [&](size_t worker, std::span<const IndexType> mapping) {
+            found[worker].emplace_back(mapping.begin(), mapping.end());
+        });
+
+    std::vector<std::vector<T>> result;
+    for (const auto &embeddings : found)
+    {
+        for (const auto &embedding : embeddings)
+        {
+            result.emplace_back(
+                this->getNodeMap().convertIndexToNodeName(embedding));
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+template <typename PatternT, typename PatternIndexType>
+constexpr internals::PatternAdjacency GraphPatternMatching<
+    T, IndexType>::internal_patternAdjacency(const GraphPrimitives<
+                                             PatternT, PatternIndexType>
+                                                 &pattern)
+{
+    const auto nodes = pattern.getNodes();
+    internals::PatternAdjacency adjacency(nodes.size());
+    for (size_t node = 0; node < nodes.size(); node++)
+    {
+        for (const auto &neighbor : pattern.getNeighbors(nodes[node]))
+        {
+            const auto position = std::ranges::find(nodes, neighbor);
+            adjacency.addEdge(
+                node, static_cast<size_t>(position - nodes.begin()));
+        }
+    }
+    return adjacency;
+}
+
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphPatternMatching<
+    T, IndexType>::internal_sortedNeighbors() const
+{
+    auto graph = this->internal_compressNeighbors();
+    graph.sortAndDeduplicateRows();
+    return graph;
+}
+
+}; // namespace jGraph
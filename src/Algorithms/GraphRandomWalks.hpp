@@ -0,0 +1,160 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "Parallel.hpp"
+#include "RandomWalkEngine.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace jGraph
+{
+
+struct randomWalkParameters
+{
+    // Nodes per walk, the starting node included
+    size_t walkLength = 80;
+    size_t walksPerNode = 10;
+    // Steps follow edge weights on weighted graphs, uniformly otherwise
+    bool weighted = true;
+    // node2vec return parameter p and in-out parameter q. Going back to the
+    // previous node is weighted by 1 / p, going to one of its neighbors by 1
+    // and going further by 1 / q.
+    double returnParameter = 1;
+    double inOutParameter = 1;
+    uint64_t seed = 0;
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphRandomWalks : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // walksPerNode walks start from every node, following edge directions.
+    // Walk w starts from the node of index w % V, and is the same whatever
+    // the number of threads for a given seed.
+    [[nodiscard]] constexpr size_t numberOfRandomWalks(
+        const randomWalkParameters &parameters = {}) const;
+
+    // Writes walk w to output[w * walkLength, (w + 1) * walkLength), output
+    // holding numberOfRandomWalks * walkLength nodes. Walks stopped early by
+    // a node without outgoing edges repeat their last node.
+    constexpr void randomWalks(
+        std::span<T> output,
+        const randomWalkParameters &parameters = {}) const;
+
+    [[nodiscard]] constexpr std::vector<T> randomWalks(
+        const randomWalkParameters &parameters = {}) const;
+
+    // Calls onWalk(std::span<const T>) for every walk without storing them.
+    // Calls come from several threads at once, so the callback has to be
+    // thread safe, and the span is only valid during the call. Walks stopped
+    // early are shorter than walkLength.
+    template <typename Callback>
+    constexpr void forEachRandomWalk(
+        Callback &&onWalk, const randomWalkParameters &parameters = {}) const;
+
+  private:
+    // Calls onWalk(worker, walk, std::span<const IndexType>) for every walk
+    template <typename Callback>
+    constexpr void internal_forEachRandomWalk(
+        const randomWalkParameters &parameters, Callback &&onWalk) const;
+};
+
+template <typename T, typename IndexType>
+constexpr size_t GraphRandomWalks<T, IndexType>::numberOfRandomWalks(
+    const randomWalkParameters &parameters) const
+{
+    return parameters.walksPerNode * this->getNumberOfNodes();
+}
+
+template <typename T, typename IndexType>
+constexpr void GraphRandomWalks<T, IndexType>::randomWalks(
+    std::span<T> output, const randomWalkParameters &parameters) const
+{
+    const auto walkLength = parameters.walkLength;
+    assert(output.size() >= numberOfRandomWalks(parameters) * walkLength);
+
+    internal_forEachRandomWalk(
+        parameters,
+        [&](size_t, size_t walk, std::span<const IndexType> nodes) {
+            const auto slot = output.subspan(walk * walkLength, walkLength);
+            for (size_t step = 0; step < nodes.size(); step++)
+            {
+                slot[step] =
+                    this->getNodeMap().convertIndexToNodeName(nodes[step]);
+            }
+            std::fill(slot.begin() + static_cast<std::ptrdiff_t>(nodes.size()),
+                      slot.end(), slot[nodes.size() - 1]);
+        });
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<T> GraphRandomWalks<T, IndexType>::randomWalks(
+    const randomWalkParameters &parameters) const
+{
+    std::vector<T> result(numberOfRandomWalks(parameters) *
+                          parameters.walkLength);
+    randomWalks(result, parameters);
+    return result;
+}
+
+template <typename T, typename IndexType>
+template <typename Callback>
+constexpr void GraphRandomWalks<T, IndexType>::forEachRandomWalk(
+    Callback &&onWalk, const randomWalkParameters &parameters) const
+{
+    std::vector<std::vector<T>> names(
+        internals::numberOfWorkers(numberOfRandomWalks(parameters)));
+    internal_forEachRandomWalk(
+        parameters,
+        [&](size_t worker, size_t, std::span<const IndexType> nodes) {
+            auto &walkNames = names[worker];
+            walkNames.clear();
+            for (const auto node : nodes)
+            {
+                walkNames.emplace_back(
+                    this->getNodeMap().convertIndexToNodeName(node));
+            }
+            onWalk(std::span<const T>(walkNames));
+        });
+}
+
+template <typename T, typename IndexType>
+template <typename Callback>
+constexpr void GraphRandomWalks<T, IndexType>::internal_forEachRandomWalk(
+    const randomWalkParameters &parameters, Callback &&onWalk) const
+{
+    const auto numberOfWalks = numberOfRandomWalks(parameters);
+    if (numberOfWalks == 0 || parameters.walkLength == 0)
+        return;
+
+    const auto graph = this->internal_compressOutgoingNeighbors(
+        parameters.weighted && this->isWeighted());
+    const internals::RandomWalkEngine<IndexType> engine(
+        graph, parameters.weighted, parameters.returnParameter,
+        parameters.inOutParameter);
+
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    std::vector<std::vector<IndexType>> walks(
+        internals::numberOfWorkers(numberOfWalks),
+        std::vector<IndexType>(parameters.walkLength));
+    internals::parallelFor(
+        numberOfWalks,
+        [&](size_t worker, size_t walk) {
+            internals::WalkRandomStream stream(walk, parameters.seed);
+            const auto length = engine.walk(
+                static_cast<IndexType>(walk % numberOfNodes), stream,
+                walks[worker]);
+            onWalk(worker, walk,
+                   std::span<const IndexType>(walks[worker]).first(length));
+        },
+        64);
+}
+
+}; // namespace jGraph
@@ -0,0 +1,267 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "DisjointSets.hpp"
+#include "GraphPrimitives.hpp"
+#include "IndexedHeap.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace jGraph
+{
+
+enum SpanningTreeAlgorithm : std::uint8_t
+{
+    KRUSKAL,
+    PRIM,
+    BORUVKA
+};
+
+namespace internals
+{
+
+// Edges compare by weight first, then by their extremities, which gives every
+// algorithm the same total order and makes ties break consistently
+template <typename IndexType>
+struct WeightedEdge
+{
+    double weight;
+    IndexType from;
+    IndexType to;
+
+    constexpr auto operator<=>(const WeightedEdge &) const = default;
+};
+
+} // namespace internals
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphSpanningTrees : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Minimum spanning tree of every connected component, as
+    // (from, to, weight) edges. Edge directions are ignored and unweighted
+    // graphs give every edge a weight of 1. Kruskal is a good default, Prim
+    // suits dense graphs such as MatrixGraph and Boruvka spreads the work of
+    // very large sparse graphs over every core.
+    [[nodiscard]] constexpr std::vector<std::tuple<T, T, double>>
+    minimumSpanningForest(SpanningTreeAlgorithm algorithm = KRUSKAL) const;
+
+  private:
+    using Edge = internals::WeightedEdge<IndexType>;
+
+    [[nodiscard]] static constexpr double internal_edgeWeight(
+        const internals::CompressedAdjacency<IndexType> &graph, IndexType node,
+        size_t neighborPosition);
+
+    [[nodiscard]] static constexpr std::vector<Edge> internal_kruskal(
+        const internals::CompressedAdjacency<IndexType> &graph);
+    [[nodiscard]] static constexpr std::vector<Edge> internal_prim(
+        const internals::CompressedAdjacency<IndexType> &graph);
+    [[nodiscard]] static constexpr std::vector<Edge> internal_boruvka(
+        const internals::CompressedAdjacency<IndexType> &graph);
+};
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::tuple<T, T, double>> GraphSpanningTrees<
+    T, IndexType>::minimumSpanningForest(SpanningTreeAlgorithm algorithm) const
+{
+    const auto graph = this->internal_compressUndirectedNeighbors();
+
+    std::vector<Edge> forest;
+    switch (algorithm)
+    {
+    case PRIM:
+        forest = internal_prim(graph);
+        break;
+    case BORUVKA:
+        forest = internal_boruvka(graph);
+        break;
+    case KRUSKAL:
+    default:
+        forest = internal_kruskal(graph);
+        break;
+    }
+
+    std::vector<std::tuple<T, T, double>> result;
+    result.reserve(forest.size());
+    for (const auto &edge : forest)
+    {
+        result.emplace_back(
+            this->getNodeMap().convertIndexToNodeName(edge.from),
+            this->getNodeMap().convertIndexToNodeName(edge.to), edge.weight);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphSpanningTrees<T, IndexType>::internal_edgeWeight(
+    const internals::CompressedAdjacency<IndexType> &graph, IndexType node,
+    size_t neighborPosition)
+{
+    if (!graph.isWeighted())
+        return 1;
+    return graph.getWeights(node)[neighborPosition];
+}
+
+template <typename T, typename IndexType>
+constexpr auto GraphSpanningTrees<T, IndexType>::internal_kruskal(
+    const internals::CompressedAdjacency<IndexType> &graph) -> std::vector<Edge>
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    std::vector<Edge> edges;
+    edges.reserve(graph.getNumberOfArcs() / 2);
+    for (size_t i = 0; i < numberOfNodes; i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        const auto neighbors = graph.getNeighbors(node);
+        for (size_t j = 0; j < neighbors.size(); j++)
+        {
+            if (node < neighbors[j])
+            {
+                edges.emplace_back(internal_edgeWeight(graph, node, j), node,
+                                   neighbors[j]);
+            }
+        }
+    }
+    internals::parallelSort(edges.begin(), edges.end());
+
+    std::vector<Edge> forest;
+    forest.reserve(numberOfNodes);
+    internals::DisjointSets<IndexType> sets(numberOfNodes);
+    for (const auto &edge : edges)
+    {
+        if (sets.unite(edge.from, edge.to))
+        {
+            forest.emplace_back(edge);
+            if (sets.getNumberOfSets() == 1)
+                break;
+        }
+    }
+    return forest;
+}
+
+template <typename T, typename IndexType>
+constexpr auto GraphSpanningTrees<T, IndexType>::internal_prim(
+    const internals::CompressedAdjacency<IndexType> &graph) -> std::vector<Edge>
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+
+    std::vector<Edge> forest;
+    forest.reserve(numberOfNodes);
+    std::vector<bool> inTree(numberOfNodes, false);
+    std::vector<std::optional<IndexType>> attachedTo(numberOfNodes);
+    internals::IndexedHeap<IndexType> heap(numberOfNodes);
+
+    for (size_t root = 0; root < numberOfNodes; root++)
+    {
+        if (inTree[root])
+            continue;
+
+        heap.push(static_cast<IndexType>(root), 0);
+        while (!heap.empty())
+        {
+            const auto [node, weight] = heap.pop();
+            const auto nodeIndex = static_cast<size_t>(node);
+            inTree[nodeIndex] = true;
+            if (const auto parent = attachedTo[nodeIndex])
+            {
+                forest.emplace_back(weight, std::min(parent.value(), node),
+                                    std::max(parent.value(), node));
+            }
+
+            const auto neighbors = graph.getNeighbors(node);
+            for (size_t j = 0; j < neighbors.size(); j++)
+            {
+                const auto neighbor = neighbors[j];
+                if (inTree[static_cast<size_t>(neighbor)])
+                    continue;
+                if (heap.pushOrImprove(neighbor,
+                                       internal_edgeWeight(graph, node, j)))
+                    attachedTo[static_cast<size_t>(neighbor)] = node;
+            }
+        }
+    }
+    return forest;
+}
+
+template <typename T, typename IndexType>
+constexpr auto GraphSpanningTrees<T, IndexType>::internal_boruvka(
+    const internals::CompressedAdjacency<IndexType> &graph) -> std::vector<Edge>
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    const Edge noEdge{std::numeric_limits<double>::infinity(), IndexType{0},
+                      IndexType{0}};
+
+    std::vector<Edge> forest;
+    forest.reserve(numberOfNodes);
+    internals::DisjointSets<IndexType> sets(numberOfNodes);
+    std::vector<IndexType> componentOf(numberOfNodes);
+    std::vector<Edge> cheapestOfNode(numberOfNodes);
+    std::vector<Edge> cheapestOfComponent(numberOfNodes);
+
+    bool merged = true;
+    while (merged)
+    {
+        for (size_t i = 0; i < numberOfNodes; i++)
+            componentOf[i] = sets.find(static_cast<IndexType>(i));
+
+        // Every node looks for its cheapest edge leaving its component, which
+        // only reads shared state and therefore runs in parallel
+        internals::parallelFor(
+            numberOfNodes,
+            [&](size_t, size_t i) {
+                const auto node = static_cast<IndexType>(i);
+                const auto neighbors = graph.getNeighbors(node);
+                auto cheapest = noEdge;
+                for (size_t j = 0; j < neighbors.size(); j++)
+                {
+                    const auto neighbor = neighbors[j];
+                    if (componentOf[i] ==
+                        componentOf[static_cast<size_t>(neighbor)])
+                        continue;
+
+                    const Edge edge{internal_edgeWeight(graph, node, j),
+                                    std::min(node, neighbor),
+                                    std::max(node, neighbor)};
+                    cheapest = std::min(cheapest, edge);
+                }
+                cheapestOfNode[i] = cheapest;
+            },
+            256);
+
+        std::ranges::fill(cheapestOfComponent, noEdge);
+        for (size_t i = 0; i < numberOfNodes; i++)
+        {
+            auto &cheapest =
+                cheapestOfComponent[static_cast<size_t>(componentOf[i])];
+            cheapest = std::min(cheapest, cheapestOfNode[i]);
+        }
+
+        merged = false;
+        for (size_t i = 0; i < numberOfNodes; i++)
+        {
+            const auto &edge = cheapestOfComponent[i];
+            if (edge.weight == noEdge.weight)
+                continue;
+            // Two components may pick the same edge, the second pick is a no-op
+            if (sets.unite(edge.from, edge.to))
+            {
+                forest.emplace_back(edge);
+                merged = true;
+            }
+        }
+    }
+    return forest;
+}
+
+}; // namespace jGraph
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "ShortestPathEngine.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+template <typename NodeType>
+struct weightedPath
+{
+    std::vector<NodeType> nodes;
+    double length = 0;
+};
+
+namespace internals
+{
+
+// Yen's algorithm, producing the loopless paths between two nodes one at a
+// time by non decreasing length. Every new path is searched as a deviation
+// from the last one: for each of its nodes, the spur node, the arcs that
+// previous paths sharing the same root take out of it and the nodes of the
+// root are banned in a single shortest path engine, so that no copy of the
+// graph is made.
+template <typename IndexType>
+class KShortestPathsEngine
+{
+  public:
+    // The snapshot must be weighted with non negative weights
+    constexpr KShortestPathsEngine(CompressedAdjacency<IndexType> graph,
+                                   IndexType source, IndexType target);
+
+    // Next shortest path, nothing once all the paths were produced
+    [[nodiscard]] constexpr std::optional<weightedPath<IndexType>> next();
+
+  private:
+    // Kept on the heap so that the engine still points to it once moved
+    std::unique_ptr<const CompressedAdjacency<IndexType>> graph;
+    ShortestPathEngine<IndexType> engine;
+    IndexType source;
+    IndexType target;
+
+    // Paths already produced, with the distance from the source of each of
+    // their nodes, and deviations waiting to be produced
+    std::vector<std::vector<IndexType>> paths;
+    std::vector<std::vector<double>> prefixLengths;
+    std::set<std::pair<double, std::vector<IndexType>>> candidates;
+    // Nodes of every path produced or waiting to be. The same deviation can
+    // be found from several spur nodes, its length summed in another order.
+    std::set<std::vector<IndexType>> knownPaths;
+    bool started = false;
+
+    [[nodiscard]] constexpr double arcWeight(IndexType from,
+                                             IndexType to) const;
+    constexpr void addCandidate(double length, std::vector<IndexType> path);
+    constexpr void findDeviations();
+};
+
+template <typename IndexType>
+constexpr KShortestPathsEngine<IndexType>::KShortestPathsEngine(
+    CompressedAdjacency<IndexType> snapshot, IndexType from, IndexType to)
+    : graph(std::make_unique<const CompressedAdjacency<IndexType>>(
+          std::move(snapshot))),
+      engine(*graph), source(from), target(to)
+{
+}
+
+template <typename IndexType>
+constexpr std::optional<weightedPath<IndexType>> KShortestPathsEngine<
+    IndexType>::next()
+{
+    if (!started)
+    {
+        started = true;
+        if (source == target)
+            addCandidate(0, std::vector<IndexType>{source});
+        else
+        {
+            engine.djikstra(source, target);
+            if (engine.isReached(target))
+            {
+                std::vector<IndexType> path{target};
+                while (const auto parent = engine.getParent(path.back()))
+                    path.emplace_back(parent.value());
+                std::ranges::reverse(path);
+                addCandidate(engine.getDistance(target), std::move(path));
+            }
+        }
+    }
+    else
+        findDeviations();
+
+    if (candidates.empty())
+        return std::nullopt;
+
+    auto [length, path] = std::move(candidates.extract(candidates.begin())
+                                        .value());
+    std::vector<double> lengths(path.size(), 0);
+    for (size_t position = 1; position < path.size(); position++)
+    {
+        lengths[position] = lengths[position - 1] +
+                            arcWeight(path[position - 1], path[position]);
+    }
+    paths.emplace_back(path);
+    prefixLengths.emplace_back(std::move(lengths));
+    return weightedPath<IndexType>{std::move(path), length};
+}
+
+template <typename IndexType>
+constexpr void KShortestPathsEngine<IndexType>::addCandidate(
+    double length, std::vector<IndexType> path)
+{
+    if (knownPaths.insert(path).second)
+        candidates.emplace(length, std::move(path));
+}
+
+template <typename IndexType>
+constexpr void KShortestPathsEngine<IndexType>::findDeviations()
+{
+    const auto &last = paths.back();
+    const auto &lastLengths = prefixLengths.back();
+    for (size_t spur = 0; spur + 1 < last.size(); spur++)
+    {
+        const auto spurNode = last[spur];
+
+        // Paths sharing the root up to the spur node already went through
+        // their next arc
+        const auto firstArc = graph->getRowOffset(spurNode);
+        const auto neighbors = graph->getNeighbors(spurNode);
+        for (const auto &path : paths)
+        {
+            if (path.size() <= spur + 1 ||
+                !std::ranges::equal(
+                    path.begin(),
+                    path.begin() + static_cast<std::ptrdiff_t>(spur + 1),
+                    last.begin(),
+                    last.begin() + static_cast<std::ptrdiff_t>(spur + 1)))
+                continue;
+
+            for (size_t i = 0; i < neighbors.size(); i++)
+            {
+                if (neighbors[i] == path[spur + 1])
+                    engine.banArc(firstArc + i);
+            }
+        }
+        for (size_t root = 0; root < spur; root++)
+            engine.banNode(last[root]);
+
+        engine.djikstra(spurNode, target);
+        if (engine.isReached(target))
+        {
+            std::vector<IndexType> spurPath{target};
+            while (spurPath.back() != spurNode)
+            {
+                spurPath.emplace_back(
+                    engine.getParent(spurPath.back()).value());
+            }
+
+            std::vector<IndexType> path(
+                last.begin(), last.begin() + static_cast<std::ptrdiff_t>(spur));
+            path.insert(path.end(), spurPath.rbegin(), spurPath.rend());
+            addCandidate(lastLengths[spur] + engine.getDistance(target),
+                         std::move(path));
+        }
+        engine.clearBans();
+    }
+}
+
+template <typename IndexType>
+constexpr double KShortestPathsEngine<IndexType>::arcWeight(IndexType from,
+                                                            IndexType to) const
+{
+    // Searches follow the lightest of parallel arcs
+    const auto neighbors = graph->getNeighbors(from);
+    const auto weights = graph->getWeights(from);
+    auto weight = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i < neighbors.size(); i++)
+    {
+        if (neighbors[i] == to)
+            weight = std::min(weight, weights[i]);
+    }
+    return weight;
+}
+
+} // namespace internals
+
+} // namespace jGraph
@@ -0,0 +1,538 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Edge of a flow network. Undirected edges carry the same capacity in both
+// directions, directed edges have a reverse capacity of 0.
+template <typename IndexType>
+struct FlowEdge
+{
+    IndexType from;
+    IndexType to;
+    double capacity;
+    double reverseCapacity;
+};
+
+// Residual graph in compressed sparse row form. Every edge becomes a pair of
+// opposite arcs stored in the rows of their tails, each arc knowing where its
+// reverse is, so that pushing flow is two writes to flat arrays.
+template <typename IndexType>
+class ResidualNetwork
+{
+  public:
+    constexpr ResidualNetwork(size_t numberOfNodes,
+                              std::span<const FlowEdge<IndexType>> edges);
+
+    [[nodiscard]] constexpr size_t getNumberOfNodes() const;
+    [[nodiscard]] constexpr size_t getNumberOfArcs() const;
+
+    [[nodiscard]] constexpr size_t getFirstArc(IndexType node) const;
+    [[nodiscard]] constexpr size_t getEndArc(IndexType node) const;
+    [[nodiscard]] constexpr IndexType getHead(size_t arc) const;
+    [[nodiscard]] constexpr size_t getReverse(size_t arc) const;
+    [[nodiscard]] constexpr double getResidual(size_t arc) const;
+
+    constexpr void push(size_t arc, double amount);
+
+    // Net flow along the given edge, negative if it flows from its head to
+    // its tail
+    [[nodiscard]] constexpr double getEdgeFlow(size_t edge) const;
+
+    // Nodes reachable from the source through arcs with residual capacity,
+    // which is the source side of a minimum cut once the flow is maximum
+    [[nodiscard]] constexpr std::vector<bool> getResidualReachable(
+        IndexType source) const;
+
+  private:
+    std::vector<size_t> offsets;
+    std::vector<IndexType> heads;
+    std::vector<size_t> reverses;
+    std::vector<double> residuals;
+    std::vector<size_t> edgeArcs;
+    std::vector<double> edgeCapacities;
+};
+
+// Highest-label push-relabel with the gap and global relabeling heuristics
+template <typename IndexType>
+class PushRelabel
+{
+  public:
+    constexpr explicit PushRelabel(ResidualNetwork<IndexType> &network);
+
+    // Returns the value of the maximum flow, which is left in the network
+    constexpr double run(IndexType source, IndexType sink);
+
+  private:
+    ResidualNetwork<IndexType> *network;
+    size_t numberOfNodes;
+    IndexType source{};
+    IndexType sink{};
+
+    std::vector<size_t> heights;
+    std::vector<double> excesses;
+    std::vector<size_t> currentArcs;
+    std::vector<size_t> nodesPerHeight;
+    std::vector<std::vector<IndexType>> activeNodes;
+    size_t highestActive = 0;
+    size_t workSinceRelabel = 0;
+
+    constexpr void activate(IndexType node);
+    constexpr void discharge(IndexType node);
+    constexpr void relabel(IndexType node);
+    constexpr void gap(size_t emptyHeight);
+    constexpr void globalRelabel();
+    constexpr void breadthFirstLabel(IndexType root, size_t rootHeight,
+                                     std::vector<IndexType> &queue);
+};
+
+// Dinic's blocking flows, which run in O(E * sqrt(V)) on unit capacity graphs
+template <typename IndexType>
+class Dinic
+{
+  public:
+    constexpr explicit Dinic(ResidualNetwork<IndexType> &network);
+
+    // Returns the value of the maximum flow, which is left in the network
+    constexpr double run(IndexType source, IndexType sink);
+
+  private:
+    static constexpr size_t UNREACHED = std::numeric_limits<size_t>::max();
+
+    ResidualNetwork<IndexType> *network;
+    std::vector<size_t> levels;
+    std::vector<size_t> currentArcs;
+    std::vector<IndexType> queue;
+    std::vector<size_t> path;
+
+    constexpr bool buildLevels(IndexType source, IndexType sink);
+    constexpr double blockingFlow(IndexType source, IndexType sink);
+};
+
+template <typename IndexType>
+constexpr ResidualNetwork<IndexType>::ResidualNetwork(
+    size_t numberOfNodes, std::span<const FlowEdge<IndexType>> edges)
+    : offsets(numberOfNodes + 1, 0), heads(2 * edges.size()),
+      reverses(2 * edges.size()), residuals(2 * edges.size()),
+      edgeArcs(edges.size()), edgeCapacities(edges.size())
+{
+    for (const auto &edge : edges)
+    {
+        offsets[static_cast<size_t>(edge.from) + 1]++;
+        offsets[static_cast<size_t>(edge.to) + 1]++;
+    }
+    for (size_t node = 0; node < numberOfNodes; node++)
+        offsets[node + 1] += offsets[node];
+
+    std::vector<size_t> nextArc(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < edges.size(); i++)
+    {
+        const auto &edge = edges[i];
+        assert(edge.capacity >= 0 && edge.reverseCapacity >= 0);
+
+        const auto forward = nextArc[static_cast<size_t>(edge.from)]++;
+        const auto backward = nextArc[static_cast<size_t>(edge.to)]++;
+        heads[forward] = edge.to;
+        heads[backward] = edge.from;
+        reverses[forward] = backward;
+        reverses[backward] = forward;
+        residuals[forward] = edge.capacity;
+        residuals[backward] = edge.reverseCapacity;
+        edgeArcs[i] = forward;
+        edgeCapacities[i] = edge.capacity;
+    }
+}
+
+template <typename IndexType>
+constexpr size_t ResidualNetwork<IndexType>::getNumberOfNodes() const
+{
+    return offsets.size() - 1;
+}
+
+template <typename IndexType>
+constexpr size_t ResidualNetwork<IndexType>::getNumberOfArcs() const
+{
+    return heads.size();
+}
+
+template <typename IndexType>
+constexpr size_t ResidualNetwork<IndexType>::getFirstArc(IndexType node) const
+{
+    return offsets[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr size_t ResidualNetwork<IndexType>::getEndArc(IndexType node) const
+{
+    return offsets[static_cast<size_t>(node) + 1];
+}
+
+template <typename IndexType>
+constexpr IndexType ResidualNetwork<IndexType>::getHead(size_t arc) const
+{
+    return heads[arc];
+}
+
+template <typename IndexType>
+constexpr size_t ResidualNetwork<IndexType>::getReverse(size_t arc) const
+{
+    return reverses[arc];
+}
+
+template <typename IndexType>
+constexpr double ResidualNetwork<IndexType>::getResidual(size_t arc) const
+{
+    return residuals[arc];
+}
+
+template <typename IndexType>
+constexpr void ResidualNetwork<IndexType>::push(size_t arc, double amount)
+{
+    residuals[arc] -= amount;
+    residuals[reverses[arc]] += amount;
+}
+
+template <typename IndexType>
+constexpr double ResidualNetwork<IndexType>::getEdgeFlow(size_t edge) const
+{
+    return edgeCapacities[edge] - residuals[edgeArcs[edge]];
+}
+
+template <typename IndexType>
+constexpr std::vector<bool> ResidualNetwork<IndexType>::getResidualReachable(
+    IndexType source) const
+{
+    std::vector<bool> reached(getNumberOfNodes(), false);
+    std::vector<IndexType> stack{source};
+    reached[static_cast<size_t>(source)] = true;
+    while (!stack.empty())
+    {
+        const auto node = stack.back();
+        stack.pop_back();
+        for (auto arc = getFirstArc(node); arc < getEndArc(node); arc++)
+        {
+            const auto head = static_cast<size_t>(heads[arc]);
+            if (residuals[arc] > 0 && !reached[head])
+            {
+                reached[head] = true;
+                stack.emplace_back(heads[arc]);
+            }
+        }
+    }
+    return reached;
+}
+
+template <typename IndexType>
+constexpr PushRelabel<IndexType>::PushRelabel(
+    ResidualNetwork<IndexType> &residualNetwork)
+    : network(&residualNetwork),
+      numberOfNodes(residualNetwork.getNumberOfNodes()),
+      heights(numberOfNodes, 0), excesses(numberOfNodes, 0),
+      currentArcs(numberOfNodes, 0), nodesPerHeight((2 * numberOfNodes) + 1),
+      activeNodes((2 * numberOfNodes) + 1)
+{
+}
+
+template <typename IndexType>
+constexpr double PushRelabel<IndexType>::run(IndexType sourceNode,
+                                             IndexType sinkNode)
+{
+    assert(sourceNode != sinkNode);
+    source = sourceNode;
+    sink = sinkNode;
+
+    for (auto arc = network->getFirstArc(source);
+         arc < network->getEndArc(source); arc++)
+    {
+        const auto amount = network->getResidual(arc);
+        if (amount <= 0)
+            continue;
+        network->push(arc, amount);
+        excesses[static_cast<size_t>(network->getHead(arc))] += amount;
+        excesses[static_cast<size_t>(source)] -= amount;
+    }
+    globalRelabel();
+
+    // Relabeling from scratch costs a linear pass, so it is only worth it
+    // once local relabels did a comparable amount of work
+    const auto relabelPeriod = (6 * numberOfNodes) + network->getNumberOfArcs();
+    while (true)
+    {
+        while (highestActive > 0 && activeNodes[highestActive].empty())
+            highestActive--;
+        if (activeNodes[highestActive].empty())
+            break;
+
+        const auto node = activeNodes[highestActive].back();
+        activeNodes[highestActive].pop_back();
+        if (heights[static_cast<size_t>(node)] != highestActive)
+        {
+            activate(node);
+            continue;
+        }
+
+        discharge(node);
+        if (workSinceRelabel > relabelPeriod)
+            globalRelabel();
+    }
+    return excesses[static_cast<size_t>(sink)];
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::activate(IndexType node)
+{
+    if (node == source || node == sink)
+        return;
+    const auto height = heights[static_cast<size_t>(node)];
+    activeNodes[height].emplace_back(node);
+    highestActive = std::max(highestActive, height);
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::discharge(IndexType node)
+{
+    const auto index = static_cast<size_t>(node);
+    while (excesses[index] > 0)
+    {
+        if (currentArcs[index] == network->getEndArc(node))
+        {
+            const auto oldHeight = heights[index];
+            relabel(node);
+            if (oldHeight < numberOfNodes && nodesPerHeight[oldHeight] == 0)
+                gap(oldHeight);
+            if (heights[index] >= 2 * numberOfNodes)
+                break;
+            continue;
+        }
+
+        const auto arc = currentArcs[index];
+        const auto head = network->getHead(arc);
+        const auto headIndex = static_cast<size_t>(head);
+        if (network->getResidual(arc) > 0 &&
+            heights[index] == heights[headIndex] + 1)
+        {
+            const auto amount =
+                std::min(excesses[index], network->getResidual(arc));
+            const bool headWasActive = excesses[headIndex] > 0;
+            network->push(arc, amount);
+            excesses[index] -= amount;
+            excesses[headIndex] += amount;
+            if (!headWasActive)
+                activate(head);
+        }
+        else
+        {
+            currentArcs[index]++;
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::relabel(IndexType node)
+{
+    const auto index = static_cast<size_t>(node);
+    auto newHeight = 2 * numberOfNodes;
+    for (auto arc = network->getFirstArc(node); arc < network->getEndArc(node);
+         arc++)
+    {
+        if (network->getResidual(arc) > 0)
+        {
+            newHeight = std::min(
+                newHeight,
+                heights[static_cast<size_t>(network->getHead(arc))] + 1);
+        }
+    }
+    workSinceRelabel +=
+        network->getEndArc(node) - network->getFirstArc(node) + 12;
+
+    nodesPerHeight[heights[index]]--;
+    heights[index] = newHeight;
+    nodesPerHeight[newHeight]++;
+    currentArcs[index] = network->getFirstArc(node);
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::gap(size_t emptyHeight)
+{
+    // No node is left at emptyHeight, so nodes above it cannot reach the sink
+    // anymore and may only send their excess back to the source. They are
+    // inactive, since the node being discharged had the highest label.
+    for (size_t index = 0; index < numberOfNodes; index++)
+    {
+        auto &height = heights[index];
+        if (height > emptyHeight && height < numberOfNodes)
+        {
+            nodesPerHeight[height]--;
+            height = numberOfNodes + 1;
+            nodesPerHeight[height]++;
+            currentArcs[index] =
+                network->getFirstArc(static_cast<IndexType>(index));
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::globalRelabel()
+{
+    // Exact distances to the sink in the residual graph, or to the source
+    // offset by the number of nodes for nodes that cannot reach the sink
+    const auto unlabeled = 2 * numberOfNodes;
+    std::ranges::fill(heights, unlabeled);
+    std::ranges::fill(nodesPerHeight, 0);
+
+    std::vector<IndexType> queue;
+    queue.reserve(numberOfNodes);
+    heights[static_cast<size_t>(source)] = numberOfNodes;
+    breadthFirstLabel(sink, 0, queue);
+    breadthFirstLabel(source, numberOfNodes, queue);
+
+    for (auto &nodes : activeNodes)
+        nodes.clear();
+    highestActive = 0;
+    for (size_t index = 0; index < numberOfNodes; index++)
+    {
+        const auto node = static_cast<IndexType>(index);
+        nodesPerHeight[heights[index]]++;
+        currentArcs[index] = network->getFirstArc(node);
+        if (excesses[index] > 0 && heights[index] < unlabeled)
+            activate(node);
+    }
+    workSinceRelabel = 0;
+}
+
+template <typename IndexType>
+constexpr void PushRelabel<IndexType>::breadthFirstLabel(
+    IndexType root, size_t rootHeight, std::vector<IndexType> &queue)
+{
+    const auto unlabeled = 2 * numberOfNodes;
+    queue.clear();
+    queue.emplace_back(root);
+    heights[static_cast<size_t>(root)] = rootHeight;
+    for (size_t next = 0; next < queue.size(); next++)
+    {
+        const auto node = queue[next];
+        const auto height = heights[static_cast<size_t>(node)];
+        for (auto arc = network->getFirstArc(node);
+             arc < network->getEndArc(node); arc++)
+        {
+            const auto tail = network->getHead(arc);
+            auto &tailHeight = heights[static_cast<size_t>(tail)];
+            if (tailHeight == unlabeled &&
+                network->getResidual(network->getReverse(arc)) > 0)
+            {
+                tailHeight = height + 1;
+                queue.emplace_back(tail);
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr Dinic<IndexType>::Dinic(ResidualNetwork<IndexType> &residualNetwork)
+    : network(&residualNetwork),
+      levels(residualNetwork.getNumberOfNodes(), UNREACHED),
+      currentArcs(residualNetwork.getNumberOfNodes(), 0)
+{
+    queue.reserve(residualNetwork.getNumberOfNodes());
+}
+
+template <typename IndexType>
+constexpr double Dinic<IndexType>::run(IndexType source, IndexType sink)
+{
+    assert(source != sink);
+    double flow = 0;
+    while (buildLevels(source, sink))
+        flow += blockingFlow(source, sink);
+    return flow;
+}
+
+template <typename IndexType>
+constexpr bool Dinic<IndexType>::buildLevels(IndexType source, IndexType sink)
+{
+    std::ranges::fill(levels, UNREACHED);
+    queue.clear();
+    queue.emplace_back(source);
+    levels[static_cast<size_t>(source)] = 0;
+    for (size_t next = 0; next < queue.size(); next++)
+    {
+        const auto node = queue[next];
+        const auto level = levels[static_cast<size_t>(node)];
+        for (auto arc = network->getFirstArc(node);
+             arc < network->getEndArc(node); arc++)
+        {
+            const auto head = static_cast<size_t>(network->getHead(arc));
+            if (levels[head] == UNREACHED && network->getResidual(arc) > 0)
+            {
+                levels[head] = level + 1;
+                queue.emplace_back(network->getHead(arc));
+            }
+        }
+    }
+    return levels[static_cast<size_t>(sink)] != UNREACHED;
+}
+
+template <typename IndexType>
+constexpr double Dinic<IndexType>::blockingFlow(IndexType source,
+                                                IndexType sink)
+{
+    for (size_t index = 0; index < currentArcs.size(); index++)
+        currentArcs[index] =
+            network->getFirstArc(static_cast<IndexType>(index));
+
+    // Depth first search kept on an explicit stack of arcs, so that deep
+    // level graphs cannot overflow the call stack
+    double flow = 0;
+    path.clear();
+    while (true)
+    {
+        const auto node = path.empty() ? source : network->getHead(path.back());
+        if (node == sink)
+        {
+            auto bottleneck = std::numeric_limits<double>::infinity();
+            for (const auto arc : path)
+                bottleneck = std::min(bottleneck, network->getResidual(arc));
+
+            size_t firstSaturated = path.size();
+            for (size_t i = 0; i < path.size(); i++)
+            {
+                network->push(path[i], bottleneck);
+                if (firstSaturated == path.size() &&
+                    network->getResidual(path[i]) <= 0)
+                    firstSaturated = i;
+            }
+            flow += bottleneck;
+            path.resize(firstSaturated);
+            continue;
+        }
+
+        const auto index = static_cast<size_t>(node);
+        auto &arc = currentArcs[index];
+        while (arc < network->getEndArc(node) &&
+               (network->getResidual(arc) <= 0 ||
+                levels[static_cast<size_t>(network->getHead(arc))] !=
+                    levels[index] + 1))
+            arc++;
+
+        if (arc < network->getEndArc(node))
+        {
+            path.emplace_back(arc);
+            continue;
+        }
+
+        // Dead end, the node is useless for the rest of this phase
+        if (path.empty())
+            break;
+        levels[index] = UNREACHED;
+        path.pop_back();
+    }
+    return flow;
+}
+
+} // namespace jGraph::internals
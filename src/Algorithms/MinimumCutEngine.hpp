@@ -0,0 +1,329 @@
+#pragma once
+
+#include "DisjointSets.hpp"
+#include "IndexedHeap.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Undirected edge of a graph to cut, listed once
+template <typename IndexType>
+struct CutEdge
+{
+    IndexType from;
+    IndexType to;
+    double weight;
+};
+
+struct globalCut
+{
+    double weight = std::numeric_limits<double>::infinity();
+    // Whether every node is on the first side of the cut
+    std::vector<bool> firstSide;
+};
+
+// Cut of weight 0 between the component of node 0 and the other nodes,
+// nothing if the graph is connected
+template <typename IndexType>
+[[nodiscard]] constexpr std::optional<globalCut> disconnectedCut(
+    size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges)
+{
+    DisjointSets<IndexType> components(numberOfNodes);
+    for (const auto &edge : edges)
+        components.unite(edge.from, edge.to);
+    if (components.getNumberOfSets() <= 1)
+        return std::nullopt;
+
+    globalCut result{0, std::vector<bool>(numberOfNodes)};
+    const auto firstComponent = components.find(IndexType{0});
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        result.firstSide[node] =
+            components.find(static_cast<IndexType>(node)) == firstComponent;
+    }
+    return result;
+}
+
+// Stoer-Wagner on a connected graph with non negative weights. Every phase
+// orders the remaining nodes by maximum adjacency with a heap, the weight
+// binding the last node to the others being a cut, then merges the last two
+// nodes. Merged nodes are represented through disjoint sets: the rows of a
+// merged node are combined, and arcs of other rows are redirected to their
+// representative when read.
+template <typename IndexType>
+[[nodiscard]] constexpr globalCut stoerWagner(
+    size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges)
+{
+    std::vector<std::vector<std::pair<IndexType, double>>> adjacency(
+        numberOfNodes);
+    for (const auto &edge : edges)
+    {
+        assert(edge.weight >= 0);
+        adjacency[static_cast<size_t>(edge.from)].emplace_back(edge.to,
+                                                               edge.weight);
+        adjacency[static_cast<size_t>(edge.to)].emplace_back(edge.from,
+                                                             edge.weight);
+    }
+
+    std::vector<std::vector<IndexType>> members(numberOfNodes);
+    std::vector<IndexType> remaining(numberOfNodes);
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        members[node].assign(1, static_cast<IndexType>(node));
+        remaining[node] = static_cast<IndexType>(node);
+    }
+
+    DisjointSets<IndexType> merged(numberOfNodes);
+    IndexedHeap<IndexType, std::greater<double>> heap(numberOfNodes);
+    std::vector<uint8_t> ordered(numberOfNodes, 0);
+    std::vector<double> mergedWeights(numberOfNodes, 0);
+    std::vector<IndexType> mergedNeighbors;
+
+    globalCut result{std::numeric_limits<double>::infinity(),
+                     std::vector<bool>(numberOfNodes, false)};
+    while (remaining.size() > 1)
+    {
+        for (const auto node : remaining)
+            ordered[static_cast<size_t>(node)] = 0;
+
+        IndexType previous = remaining.front();
+        IndexType last = remaining.front();
+        double cutOfThePhase = 0;
+        heap.push(remaining.front(), 0);
+        while (!heap.empty())
+        {
+            const auto [node, key] = heap.pop();
+            ordered[static_cast<size_t>(node)] = 1;
+            previous = last;
+            last = node;
+            cutOfThePhase = key;
+
+            for (const auto &[neighbor, weight] :
+                 adjacency[static_cast<size_t>(node)])
+            {
+                const auto representative = merged.find(neighbor);
+                if (ordered[static_cast<size_t>(representative)] != 0)
+                    continue;
+                const auto connection = heap.contains(representative)
+                                            ? heap.getKey(representative)
+                                            : 0;
+                heap.push(representative, connection + weight);
+            }
+        }
+
+        if (cutOfThePhase < result.weight)
+        {
+            result.weight = cutOfThePhase;
+            std::fill(result.firstSide.begin(), result.firstSide.end(), false);
+            for (const auto node : members[static_cast<size_t>(last)])
+                result.firstSide[static_cast<size_t>(node)] = true;
+        }
+
+        // Merges the last node into the previous one
+        merged.unite(previous, last);
+        const auto kept = static_cast<size_t>(merged.find(previous));
+        const auto dropped = static_cast<size_t>(
+            kept == static_cast<size_t>(previous) ? last : previous);
+
+        mergedNeighbors.clear();
+        for (const auto row : {kept, dropped})
+        {
+            for (const auto &[neighbor, weight] : adjacency[row])
+            {
+                const auto representative =
+                    static_cast<size_t>(merged.find(neighbor));
+                if (representative == kept)
+                    continue;
+                if (mergedWeights[representative] == 0)
+                    mergedNeighbors.emplace_back(
+                        static_cast<IndexType>(representative));
+                mergedWeights[representative] += weight;
+            }
+        }
+        adjacency[kept].clear();
+        for (const auto neighbor : mergedNeighbors)
+        {
+            auto &weight = mergedWeights[static_cast<size_t>(neighbor)];
+            adjacency[kept].emplace_back(neighbor, weight);
+            weight = 0;
+        }
+        adjacency[dropped] = {};
+
+        members[kept].insert(members[kept].end(), members[dropped].begin(),
+                             members[dropped].end());
+        members[dropped] = {};
+        std::erase(remaining, static_cast<IndexType>(dropped));
+    }
+    return result;
+}
+
+// Exact minimum cut of a small graph, trying every split. The last node is
+// always on the second side.
+template <typename IndexType>
+[[nodiscard]] constexpr globalCut smallGraphCut(
+    size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges)
+{
+    globalCut result{std::numeric_limits<double>::infinity(),
+                     std::vector<bool>(numberOfNodes, false)};
+    const auto splits = size_t{1} << (numberOfNodes - 1);
+    for (size_t split = 1; split < splits; split++)
+    {
+        double weight = 0;
+        for (const auto &edge : edges)
+        {
+            if (((split >> static_cast<size_t>(edge.from)) & 1U) !=
+                ((split >> static_cast<size_t>(edge.to)) & 1U))
+                weight += edge.weight;
+        }
+        if (weight < result.weight)
+        {
+            result.weight = weight;
+            for (size_t node = 0; node < numberOfNodes; node++)
+                result.firstSide[node] = ((split >> node) & 1U) != 0;
+        }
+    }
+    return result;
+}
+
+// Contracts random edges, picked with probabilities proportional to their
+// weights, until targetNodes nodes are left. Sorting edges by exponential
+// keys of rate equal to their weight gives the order in which such a
+// process picks them. Returns the node every node was merged into and the
+// edges between merged nodes, parallel ones being added up.
+template <typename IndexType, typename Generator>
+[[nodiscard]] constexpr std::pair<std::vector<IndexType>,
+                                  std::vector<CutEdge<IndexType>>>
+contractEdges(size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges,
+              size_t targetNodes, Generator &generator)
+{
+    std::exponential_distribution<double> distribution;
+    std::vector<std::pair<double, size_t>> order(edges.size());
+    for (size_t edge = 0; edge < edges.size(); edge++)
+    {
+        const auto weight = edges[edge].weight;
+        order[edge] = {weight > 0 ? distribution(generator) / weight
+                                  : std::numeric_limits<double>::infinity(),
+                       edge};
+    }
+    std::ranges::sort(order);
+
+    DisjointSets<IndexType> merged(numberOfNodes);
+    for (const auto &[key, edge] : order)
+    {
+        if (merged.getNumberOfSets() <= targetNodes)
+            break;
+        merged.unite(edges[edge].from, edges[edge].to);
+    }
+
+    constexpr auto UNLABELED = std::numeric_limits<size_t>::max();
+    std::vector<size_t> labels(numberOfNodes, UNLABELED);
+    std::vector<IndexType> groups(numberOfNodes);
+    size_t numberOfGroups = 0;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        auto &label = labels[static_cast<size_t>(
+            merged.find(static_cast<IndexType>(node)))];
+        if (label == UNLABELED)
+            label = numberOfGroups++;
+        groups[node] = static_cast<IndexType>(label);
+    }
+
+    std::vector<CutEdge<IndexType>> contracted;
+    for (const auto &edge : edges)
+    {
+        auto from = groups[static_cast<size_t>(edge.from)];
+        auto to = groups[static_cast<size_t>(edge.to)];
+        if (from == to)
+            continue;
+        if (to < from)
+            std::swap(from, to);
+        contracted.emplace_back(from, to, edge.weight);
+    }
+    std::ranges::sort(contracted, {}, [](const CutEdge<IndexType> &edge) {
+        return std::pair(edge.from, edge.to);
+    });
+
+    size_t kept = 0;
+    for (size_t edge = 0; edge < contracted.size(); edge++)
+    {
+        if (kept > 0 && contracted[kept - 1].from == contracted[edge].from &&
+            contracted[kept - 1].to == contracted[edge].to)
+            contracted[kept - 1].weight += contracted[edge].weight;
+        else
+            contracted[kept++] = contracted[edge];
+    }
+    contracted.resize(kept);
+    return {std::move(groups), std::move(contracted)};
+}
+
+// Karger-Stein recursive contraction of a connected graph: the graph is
+// contracted twice, independently, down to about numberOfNodes / sqrt(2)
+// nodes, and the best cut of both contracted graphs is kept
+template <typename IndexType, typename Generator>
+[[nodiscard]] constexpr globalCut recursiveContraction(
+    size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges,
+    Generator &generator)
+{
+    constexpr size_t smallGraph = 6;
+    if (numberOfNodes <= smallGraph)
+        return smallGraphCut(numberOfNodes, edges);
+
+    const auto targetNodes = static_cast<size_t>(std::ceil(
+        1 + (static_cast<double>(numberOfNodes) / std::numbers::sqrt2)));
+
+    globalCut result{std::numeric_limits<double>::infinity(),
+                     std::vector<bool>(numberOfNodes, false)};
+    for (size_t attempt = 0; attempt < 2; attempt++)
+    {
+        const auto [groups, contracted] =
+            contractEdges(numberOfNodes, edges, targetNodes, generator);
+        const auto cut = recursiveContraction<IndexType>(targetNodes,
+                                                         contracted, generator);
+        if (cut.weight < result.weight)
+        {
+            result.weight = cut.weight;
+            for (size_t node = 0; node < numberOfNodes; node++)
+            {
+                result.firstSide[node] =
+                    cut.firstSide[static_cast<size_t>(groups[node])];
+            }
+        }
+    }
+    return result;
+}
+
+// Best cut of independent Karger-Stein trials run in parallel, trial t
+// drawing from a generator seeded with seed + t. Each trial finds a minimum
+// cut with probability in O(1 / log(V)) and costs O(V^2 log(V)).
+template <typename IndexType>
+[[nodiscard]] constexpr globalCut kargerStein(
+    size_t numberOfNodes, std::span<const CutEdge<IndexType>> edges,
+    size_t trials, uint64_t seed)
+{
+    assert(trials > 0);
+    std::vector<globalCut> cuts(trials);
+    parallelFor(trials, [&](size_t, size_t trial) {
+        std::mt19937_64 generator(seed + trial);
+        cuts[trial] =
+            recursiveContraction<IndexType>(numberOfNodes, edges, generator);
+    });
+    return std::move(*std::ranges::min_element(
+        cuts, {}, [](const globalCut &cut) { return cut.weight; }));
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Nodes sorted by decreasing degree, ties broken by index
+template <typename IndexType>
+[[nodiscard]] constexpr std::vector<IndexType> largestDegreeFirstOrder(
+    const CompressedAdjacency<IndexType> &graph)
+{
+    std::vector<IndexType> order(graph.getNumberOfNodes());
+    std::iota(order.begin(), order.end(), IndexType{0});
+    std::ranges::stable_sort(order, std::greater<>{}, [&](IndexType node) {
+        return graph.getDegree(node);
+    });
+    return order;
+}
+
+// Nodes in the reverse of the order in which repeatedly removing a node of
+// minimum remaining degree deletes them, so that every node has at most
+// degeneracy neighbors placed before it. Runs in O(V + E) with one bucket
+// per degree.
+template <typename IndexType>
+[[nodiscard]] constexpr std::vector<IndexType> smallestLastOrder(
+    const CompressedAdjacency<IndexType> &graph)
+{
+    const auto numberOfNodes = graph.getNumberOfNodes();
+    std::vector<size_t> degrees(numberOfNodes);
+    size_t maxDegree = 0;
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        degrees[node] = graph.getDegree(static_cast<IndexType>(node));
+        maxDegree = std::max(maxDegree, degrees[node]);
+    }
+
+    // Nodes sorted by remaining degree, with the position of every node and
+    // the first position of every degree, so that decrementing a degree is a
+    // swap with the first node of the same bucket
+    std::vector<size_t> bucketStarts(maxDegree + 2, 0);
+    for (const auto degree : degrees)
+        bucketStarts[degree + 1]++;
+    std::partial_sum(bucketStarts.begin(), bucketStarts.end(),
+                     bucketStarts.begin());
+
+    std::vector<IndexType> sorted(numberOfNodes);
+    std::vector<size_t> positions(numberOfNodes);
+    {
+        std::vector<size_t> nextPosition(bucketStarts.begin(),
+                                         bucketStarts.end() - 1);
+        for (size_t node = 0; node < numberOfNodes; node++)
+        {
+            positions[node] = nextPosition[degrees[node]]++;
+            sorted[positions[node]] = static_cast<IndexType>(node);
+        }
+    }
+
+    std::vector<bool> removed(numberOfNodes, false);
+    std::vector<IndexType> order(numberOfNodes);
+    for (size_t position = 0; position < numberOfNodes; position++)
+    {
+        const auto node = sorted[position];
+        removed[static_cast<size_t>(node)] = true;
+        order[numberOfNodes - 1 - position] = node;
+
+        for (const auto neighbor : graph.getNeighbors(node))
+        {
+            const auto index = static_cast<size_t>(neighbor);
+            if (removed[index] || degrees[index] == 0)
+                continue;
+
+            // Degrees below the current position's bucket are already
+            // consumed, so the bucket start never moves behind position
+            auto &bucketStart = bucketStarts[degrees[index]];
+            bucketStart = std::max(bucketStart, position + 1);
+            const auto first = sorted[bucketStart];
+            std::swap(sorted[bucketStart], sorted[positions[index]]);
+            std::swap(positions[static_cast<size_t>(first)], positions[index]);
+            bucketStart++;
+            degrees[index]--;
+        }
+    }
+    return order;
+}
+
+} // namespace jGraph::internals
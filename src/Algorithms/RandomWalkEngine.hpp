@@ -0,0 +1,266 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "HyperLogLog.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// splitmix64 stream. Every walk draws from its own stream, derived from its
+// number and the seed, so that walks do not depend on how they are spread
+// over threads and cost nothing to set up.
+class WalkRandomStream
+{
+  public:
+    constexpr WalkRandomStream(uint64_t walk, uint64_t seed)
+        : streamSeed(mixHash(walk, seed))
+    {
+    }
+
+    // Uniform in [0, 1)
+    [[nodiscard]] constexpr double nextReal()
+    {
+        constexpr double scale = 0x1.0p-53;
+        return static_cast<double>(mixHash(counter++, streamSeed) >> 11U) *
+               scale;
+    }
+
+    // Uniform in [0, bound)
+    [[nodiscard]] constexpr size_t nextIndex(size_t bound)
+    {
+        const auto scaled = nextReal() * static_cast<double>(bound);
+        return std::min(bound - 1, static_cast<size_t>(scaled));
+    }
+
+  private:
+    uint64_t streamSeed;
+    uint64_t counter = 0;
+};
+
+// Random walks over a CompressedAdjacency. Weighted steps draw from alias
+// tables laid out along the arcs of the snapshot, so a step costs two
+// random numbers whatever the degree. node2vec steps draw a first order
+// step and accept it with a probability proportional to its bias relative
+// to the largest bias, which only needs a binary search in the sorted row of
+// the previous node instead of tables over every pair of consecutive arcs.
+template <typename IndexType>
+class RandomWalkEngine
+{
+  public:
+    // Weights are only followed if asked and present, and must not be
+    // negative. Return and in-out parameters of 1 give first order walks.
+    constexpr RandomWalkEngine(const CompressedAdjacency<IndexType> &graph,
+                               bool weighted, double returnParameter,
+                               double inOutParameter);
+
+    // Fills nodes with a walk from the start node, drawing from the given
+    // stream. Returns the number of nodes written, which is smaller than the
+    // size of nodes if a node without outgoing arcs was reached.
+    [[nodiscard]] constexpr size_t walk(IndexType start,
+                                        WalkRandomStream &stream,
+                                        std::span<IndexType> nodes) const;
+
+  private:
+    const CompressedAdjacency<IndexType> *graph;
+    double returnBias;
+    double inOutBias;
+    double largestBias;
+
+    // Alias tables, one entry per arc: an arc is kept with its probability
+    // and replaced by its alias, a position in the same row, otherwise
+    std::vector<double> keepProbabilities;
+    std::vector<size_t> aliases;
+
+    // Rows of the snapshot sorted, for node2vec walks
+    std::vector<IndexType> sortedNeighbors;
+
+    [[nodiscard]] constexpr bool isSecondOrder() const;
+    [[nodiscard]] constexpr size_t firstOrderStep(
+        IndexType node, WalkRandomStream &stream) const;
+    [[nodiscard]] constexpr bool isNeighbor(IndexType node,
+                                            IndexType other) const;
+    constexpr void buildAliasTables();
+};
+
+template <typename IndexType>
+constexpr RandomWalkEngine<IndexType>::RandomWalkEngine(
+    const CompressedAdjacency<IndexType> &snapshot, bool weighted,
+    double returnParameter, double inOutParameter)
+    : graph(&snapshot), returnBias(1 / returnParameter),
+      inOutBias(1 / inOutParameter),
+      largestBias(std::max({returnBias, 1.0, inOutBias}))
+{
+    assert(returnParameter > 0 && inOutParameter > 0);
+    if (weighted && snapshot.isWeighted())
+        buildAliasTables();
+
+    if (isSecondOrder())
+    {
+        sortedNeighbors.resize(snapshot.getNumberOfArcs());
+        parallelFor(
+            snapshot.getNumberOfNodes(),
+            [&](size_t, size_t node) {
+                const auto neighbors =
+                    snapshot.getNeighbors(static_cast<IndexType>(node));
+                const auto row =
+                    std::span<IndexType>(sortedNeighbors)
+                        .subspan(snapshot.getRowOffset(
+                                     static_cast<IndexType>(node)),
+                                 neighbors.size());
+                std::ranges::copy(neighbors, row.begin());
+                std::ranges::sort(row);
+            },
+            64);
+    }
+}
+
+template <typename IndexType>
+constexpr void RandomWalkEngine<IndexType>::buildAliasTables()
+{
+    const auto numberOfNodes = graph->getNumberOfNodes();
+    keepProbabilities.assign(graph->getNumberOfArcs(), 1);
+    aliases.resize(graph->getNumberOfArcs());
+
+    // Vose's method, scaled weights below 1 being topped up by weights
+    // above 1
+    std::vector<std::vector<size_t>> smallArcs(numberOfWorkers(numberOfNodes));
+    std::vector<std::vector<size_t>> largeArcs(numberOfWorkers(numberOfNodes));
+    parallelFor(
+        numberOfNodes,
+        [&](size_t worker, size_t task) {
+            const auto node = static_cast<IndexType>(task);
+            const auto firstArc = graph->getRowOffset(node);
+            const auto weights = graph->getWeights(node);
+            const auto degree = weights.size();
+
+            double total = 0;
+            for (size_t i = 0; i < degree; i++)
+            {
+                assert(weights[i] >= 0);
+                aliases[firstArc + i] = i;
+                total += weights[i];
+            }
+            if (total <= 0)
+                return;
+
+            auto &small = smallArcs[worker];
+            auto &large = largeArcs[worker];
+            small.clear();
+            large.clear();
+            for (size_t i = 0; i < degree; i++)
+            {
+                keepProbabilities[firstArc + i] =
+                    weights[i] * static_cast<double>(degree) / total;
+                if (keepProbabilities[firstArc + i] < 1)
+                    small.emplace_back(i);
+                else
+                    large.emplace_back(i);
+            }
+
+            while (!small.empty() && !large.empty())
+            {
+                const auto lighter = small.back();
+                small.pop_back();
+                const auto heavier = large.back();
+
+                aliases[firstArc + lighter] = heavier;
+                auto &remaining = keepProbabilities[firstArc + heavier];
+                remaining -= 1 - keepProbabilities[firstArc + lighter];
+                if (remaining < 1)
+                {
+                    large.pop_back();
+                    small.emplace_back(heavier);
+                }
+            }
+
+            // Whatever is left only differs from 1 by rounding errors
+            for (const auto arcs : {&small, &large})
+            {
+                for (const auto i : *arcs)
+                    keepProbabilities[firstArc + i] = 1;
+            }
+        },
+        64);
+}
+
+template <typename IndexType>
+constexpr bool RandomWalkEngine<IndexType>::isSecondOrder() const
+{
+    return returnBias != 1 || inOutBias != 1;
+}
+
+template <typename IndexType>
+constexpr size_t RandomWalkEngine<IndexType>::firstOrderStep(
+    IndexType node, WalkRandomStream &stream) const
+{
+    const auto position = stream.nextIndex(graph->getDegree(node));
+    if (keepProbabilities.empty())
+        return position;
+
+    const auto arc = graph->getRowOffset(node) + position;
+    if (stream.nextReal() < keepProbabilities[arc])
+        return position;
+    return aliases[arc];
+}
+
+template <typename IndexType>
+constexpr bool RandomWalkEngine<IndexType>::isNeighbor(IndexType node,
+                                                       IndexType other) const
+{
+    const auto row = std::span<const IndexType>(sortedNeighbors)
+                         .subspan(graph->getRowOffset(node),
+                                  graph->getDegree(node));
+    return std::ranges::binary_search(row, other);
+}
+
+template <typename IndexType>
+constexpr size_t RandomWalkEngine<IndexType>::walk(
+    IndexType start, WalkRandomStream &stream,
+    std::span<IndexType> nodes) const
+{
+    if (nodes.empty())
+        return 0;
+
+    nodes.front() = start;
+    for (size_t length = 1; length < nodes.size(); length++)
+    {
+        const auto node = nodes[length - 1];
+        if (graph->getDegree(node) == 0)
+            return length;
+
+        const auto neighbors = graph->getNeighbors(node);
+        if (length == 1 || !isSecondOrder())
+        {
+            nodes[length] = neighbors[firstOrderStep(node, stream)];
+            continue;
+        }
+
+        const auto previous = nodes[length - 2];
+        while (true)
+        {
+            const auto next = neighbors[firstOrderStep(node, stream)];
+            double bias = inOutBias;
+            if (next == previous)
+                bias = returnBias;
+            else if (isNeighbor(previous, next))
+                bias = 1;
+
+            if (stream.nextReal() * largestBias < bias)
+            {
+                nodes[length] = next;
+                break;
+            }
+        }
+    }
+    return nodes.size();
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,283 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Single source shortest path computations over a CompressedAdjacency.
+// Scratch buffers are kept between runs and only the entries touched by the
+// previous run are reset, so running it from many sources costs
+// O(visited part of the graph) per run instead of O(V).
+template <typename IndexType>
+class ShortestPathEngine
+{
+  public:
+    constexpr explicit ShortestPathEngine(
+        const CompressedAdjacency<IndexType> &graph);
+
+    // Breadth first search if the snapshot is unweighted, djikstra otherwise
+    constexpr void run(IndexType source);
+    constexpr void breadthFirstSearch(IndexType source);
+
+    // Stops as soon as the target is settled, if there is one
+    constexpr void djikstra(IndexType source,
+                            std::optional<IndexType> target = std::nullopt);
+
+    // Nodes and arcs the searches must not go through, arcs being numbered
+    // by their position in the snapshot. Bans last until cleared, so that
+    // the same graph can be searched with parts of it masked out.
+    constexpr void banNode(IndexType node);
+    constexpr void banArc(size_t arc);
+    constexpr void clearBans();
+
+    [[nodiscard]] constexpr bool isReached(IndexType node) const;
+    [[nodiscard]] constexpr double getDistance(IndexType node) const;
+    [[nodiscard]] constexpr double getNumberOfShortestPaths(
+        IndexType node) const;
+    [[nodiscard]] constexpr std::optional<IndexType> getParent(
+        IndexType node) const;
+
+    // Reached nodes, by non decreasing distance from the source
+    [[nodiscard]] constexpr std::span<const IndexType> getSettledNodes() const;
+
+  private:
+    static constexpr double UNREACHED = std::numeric_limits<double>::infinity();
+
+    const CompressedAdjacency<IndexType> *graph;
+    std::vector<double> distances;
+    std::vector<double> pathCounts;
+    std::vector<IndexType> parents;
+    std::vector<bool> settled;
+    std::vector<IndexType> settledNodes;
+    std::vector<IndexType> touchedNodes;
+    std::vector<bool> bannedNodes;
+    std::vector<bool> bannedArcs;
+    std::vector<IndexType> bannedNodeList;
+    std::vector<size_t> bannedArcList;
+
+    constexpr void reset(IndexType source);
+    constexpr void reach(IndexType node, IndexType parent, double distance);
+    [[nodiscard]] constexpr bool isBanned(size_t arc, IndexType head) const;
+};
+
+template <typename IndexType>
+constexpr ShortestPathEngine<IndexType>::ShortestPathEngine(
+    const CompressedAdjacency<IndexType> &graphToTraverse)
+    : graph(&graphToTraverse),
+      distances(graphToTraverse.getNumberOfNodes(), UNREACHED),
+      pathCounts(graphToTraverse.getNumberOfNodes(), 0),
+      parents(graphToTraverse.getNumberOfNodes()),
+      settled(graphToTraverse.getNumberOfNodes(), false)
+{
+    settledNodes.reserve(graphToTraverse.getNumberOfNodes());
+    touchedNodes.reserve(graphToTraverse.getNumberOfNodes());
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::run(IndexType source)
+{
+    if (graph->isWeighted())
+        djikstra(source);
+    else
+        breadthFirstSearch(source);
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::reset(IndexType source)
+{
+    for (const auto node : touchedNodes)
+    {
+        distances[static_cast<size_t>(node)] = UNREACHED;
+        pathCounts[static_cast<size_t>(node)] = 0;
+        settled[static_cast<size_t>(node)] = false;
+    }
+    touchedNodes.clear();
+    settledNodes.clear();
+
+    reach(source, source, 0);
+    pathCounts[static_cast<size_t>(source)] = 1;
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::reach(IndexType node,
+                                                    IndexType parent,
+                                                    double distance)
+{
+    const auto index = static_cast<size_t>(node);
+    if (distances[index] == UNREACHED)
+        touchedNodes.emplace_back(node);
+
+    distances[index] = distance;
+    parents[index] = parent;
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::breadthFirstSearch(
+    IndexType source)
+{
+    reset(source);
+    settledNodes.emplace_back(source);
+
+    for (size_t head = 0; head < settledNodes.size(); head++)
+    {
+        const auto node = settledNodes[head];
+        const auto nodeIndex = static_cast<size_t>(node);
+        const auto nextDistance = distances[nodeIndex] + 1;
+
+        const auto firstArc = graph->getRowOffset(node);
+        const auto neighbors = graph->getNeighbors(node);
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            const auto neighbor = neighbors[i];
+            const auto neighborIndex = static_cast<size_t>(neighbor);
+            if (isBanned(firstArc + i, neighbor))
+                continue;
+            if (distances[neighborIndex] == UNREACHED)
+            {
+                reach(neighbor, node, nextDistance);
+                settledNodes.emplace_back(neighbor);
+            }
+            if (distances[neighborIndex] == nextDistance)
+                pathCounts[neighborIndex] += pathCounts[nodeIndex];
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::djikstra(
+    IndexType source, std::optional<IndexType> target)
+{
+    reset(source);
+
+    using QueueEntry = std::pair<double, IndexType>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                        std::greater<QueueEntry>>
+        nodesPriorityQueue;
+    nodesPriorityQueue.emplace(0, source);
+
+    while (!nodesPriorityQueue.empty())
+    {
+        const auto [currentDistance, node] = nodesPriorityQueue.top();
+        nodesPriorityQueue.pop();
+
+        const auto nodeIndex = static_cast<size_t>(node);
+        if (settled[nodeIndex] || currentDistance > distances[nodeIndex])
+            continue;
+
+        settled[nodeIndex] = true;
+        settledNodes.emplace_back(node);
+        if (node == target)
+            break;
+
+        const auto firstArc = graph->getRowOffset(node);
+        const auto neighbors = graph->getNeighbors(node);
+        const auto weights = graph->getWeights(node);
+        for (size_t i = 0; i < neighbors.size(); i++)
+        {
+            assert(weights[i] >= 0);
+            if (isBanned(firstArc + i, neighbors[i]))
+                continue;
+            const auto neighborIndex = static_cast<size_t>(neighbors[i]);
+            const double examinedDistance = currentDistance + weights[i];
+
+            if (examinedDistance < distances[neighborIndex])
+            {
+                reach(neighbors[i], node, examinedDistance);
+                pathCounts[neighborIndex] = pathCounts[nodeIndex];
+                nodesPriorityQueue.emplace(examinedDistance, neighbors[i]);
+            }
+            else if (examinedDistance == distances[neighborIndex] &&
+                     !settled[neighborIndex])
+            {
+                pathCounts[neighborIndex] += pathCounts[nodeIndex];
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::banNode(IndexType node)
+{
+    if (bannedNodes.empty())
+        bannedNodes.assign(graph->getNumberOfNodes(), false);
+    bannedNodes[static_cast<size_t>(node)] = true;
+    bannedNodeList.emplace_back(node);
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::banArc(size_t arc)
+{
+    if (bannedArcs.empty())
+        bannedArcs.assign(graph->getNumberOfArcs(), false);
+    bannedArcs[arc] = true;
+    bannedArcList.emplace_back(arc);
+}
+
+template <typename IndexType>
+constexpr void ShortestPathEngine<IndexType>::clearBans()
+{
+    for (const auto node : bannedNodeList)
+        bannedNodes[static_cast<size_t>(node)] = false;
+    for (const auto arc : bannedArcList)
+        bannedArcs[arc] = false;
+    bannedNodeList.clear();
+    bannedArcList.clear();
+}
+
+template <typename IndexType>
+constexpr bool ShortestPathEngine<IndexType>::isBanned(size_t arc,
+                                                       IndexType head) const
+{
+    return (!bannedArcs.empty() && bannedArcs[arc]) ||
+           (!bannedNodes.empty() && bannedNodes[static_cast<size_t>(head)]);
+}
+
+template <typename IndexType>
+constexpr bool ShortestPathEngine<IndexType>::isReached(IndexType node) const
+{
+    return distances[static_cast<size_t>(node)] != UNREACHED;
+}
+
+template <typename IndexType>
+constexpr double ShortestPathEngine<IndexType>::getDistance(
+    IndexType node) const
+{
+    return distances[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr double ShortestPathEngine<IndexType>::getNumberOfShortestPaths(
+    IndexType node) const
+{
+    return pathCounts[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr std::optional<IndexType> ShortestPathEngine<IndexType>::getParent(
+    IndexType node) const
+{
+    const auto index = static_cast<size_t>(node);
+    if (distances[index] == UNREACHED || parents[index] == node)
+        return std::nullopt;
+    return parents[index];
+}
+
+template <typename IndexType>
+constexpr std::span<const IndexType> ShortestPathEngine<
+    IndexType>::getSettledNodes() const
+{
+    return settledNodes;
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Small pattern graph stored as one adjacency bitset per node
+class PatternAdjacency
+{
+  public:
+    constexpr explicit PatternAdjacency(size_t numberOfNodes);
+
+    constexpr void addEdge(size_t first, size_t second);
+
+    [[nodiscard]] constexpr size_t getNumberOfNodes() const;
+    [[nodiscard]] constexpr bool areAdjacent(size_t first,
+                                             size_t second) const;
+    [[nodiscard]] constexpr size_t getDegree(size_t node) const;
+
+  private:
+    static constexpr size_t BITS_PER_WORD = 64;
+
+    size_t numberOfNodes;
+    size_t wordsPerRow;
+    std::vector<uint64_t> bits;
+};
+
+// VF2++ style backtracking search for the injective mappings of a pattern
+// into a data graph that preserve the pattern edges, and also its non-edges
+// when the search is induced. Pattern nodes are matched in an order that
+// starts from the most constrained node and grows along the pattern edges,
+// so that candidates for every node but the first are drawn from the
+// neighbors of an already matched node.
+template <typename IndexType>
+class SubgraphMatcher
+{
+  public:
+    // The data graph must have sorted rows
+    constexpr SubgraphMatcher(const CompressedAdjacency<IndexType> &data,
+                              const PatternAdjacency &pattern, bool induced);
+
+    // Calls onEmbedding(worker, mapping) for every embedding, where
+    // mapping[i] is the image of pattern node i. Root candidates are
+    // explored in parallel, workers are numbered as in parallelFor.
+    template <typename Callback>
+    constexpr void forEachEmbedding(Callback &&onEmbedding) const;
+
+    [[nodiscard]] constexpr size_t getNumberOfWorkers() const;
+
+  private:
+    static constexpr size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+    const CompressedAdjacency<IndexType> *data;
+    bool induced;
+    size_t patternSize;
+
+    // Pattern nodes in matching order, and for every position the degree
+    // required from candidates, the earlier position candidates are drawn
+    // from, and the earlier positions they must or must not be adjacent to
+    std::vector<size_t> order;
+    std::vector<size_t> requiredDegrees;
+    std::vector<size_t> parents;
+    std::vector<std::vector<size_t>> linkedPositions;
+    std::vector<std::vector<size_t>> unlinkedPositions;
+    std::vector<IndexType> rootCandidates;
+    std::vector<IndexType> allNodes;
+
+    constexpr void computeOrder(const PatternAdjacency &pattern);
+    [[nodiscard]] constexpr bool isFeasible(
+        size_t position, IndexType candidate,
+        std::span<const IndexType> images) const;
+};
+
+constexpr PatternAdjacency::PatternAdjacency(size_t nodes)
+    : numberOfNodes(nodes), wordsPerRow((nodes + BITS_PER_WORD - 1) /
+                                        BITS_PER_WORD),
+      bits(nodes * wordsPerRow, 0)
+{
+}
+
+constexpr void PatternAdjacency::addEdge(size_t first, size_t second)
+{
+    if (first == second)
+        return;
+    bits[(first * wordsPerRow) + (second / BITS_PER_WORD)] |=
+        uint64_t{1} << (second % BITS_PER_WORD);
+    bits[(second * wordsPerRow) + (first / BITS_PER_WORD)] |=
+        uint64_t{1} << (first % BITS_PER_WORD);
+}
+
+constexpr size_t PatternAdjacency::getNumberOfNodes() const
+{
+    return numberOfNodes;
+}
+
+constexpr bool PatternAdjacency::areAdjacent(size_t first, size_t second) const
+{
+    return ((bits[(first * wordsPerRow) + (second / BITS_PER_WORD)] >>
+             (second % BITS_PER_WORD)) &
+            1U) != 0;
+}
+
+constexpr size_t PatternAdjacency::getDegree(size_t node) const
+{
+    size_t degree = 0;
+    for (size_t word = 0; word < wordsPerRow; word++)
+        degree += static_cast<size_t>(
+            std::popcount(bits[(node * wordsPerRow) + word]));
+    return degree;
+}
+
+template <typename IndexType>
+constexpr SubgraphMatcher<IndexType>::SubgraphMatcher(
+    const CompressedAdjacency<IndexType> &dataGraph,
+    const PatternAdjacency &pattern, bool inducedSearch)
+    : data(&dataGraph), induced(inducedSearch),
+      patternSize(pattern.getNumberOfNodes())
+{
+    computeOrder(pattern);
+
+    allNodes.resize(data->getNumberOfNodes());
+    std::iota(allNodes.begin(), allNodes.end(), IndexType{0});
+    if (patternSize == 0)
+        return;
+    for (const auto node : allNodes)
+    {
+        if (data->getDegree(node) >= requiredDegrees[0])
+            rootCandidates.emplace_back(node);
+    }
+}
+
+template <typename IndexType>
+constexpr void SubgraphMatcher<IndexType>::computeOrder(
+    const PatternAdjacency &pattern)
+{
+    std::vector<size_t> degrees(patternSize);
+    for (size_t node = 0; node < patternSize; node++)
+        degrees[node] = pattern.getDegree(node);
+
+    std::vector<bool> reached(patternSize, false);
+    std::vector<size_t> linksToOrdered(patternSize, 0);
+    std::vector<size_t> level;
+    std::vector<size_t> nextLevel;
+
+    // High degree nodes have the fewest candidates, every connected part of
+    // the pattern is ordered breadth first from its highest degree node, and
+    // inside a level nodes with the most links to ordered nodes come first
+    while (order.size() < patternSize)
+    {
+        size_t root = patternSize;
+        for (size_t node = 0; node < patternSize; node++)
+        {
+            if (!reached[node] &&
+                (root == patternSize || degrees[node] > degrees[root]))
+                root = node;
+        }
+
+        reached[root] = true;
+        level.assign(1, root);
+        while (!level.empty())
+        {
+            for (size_t placed = 0; placed < level.size(); placed++)
+            {
+                auto best = std::ranges::max_element(
+                    level.begin() + static_cast<std::ptrdiff_t>(placed),
+                    level.end(), {}, [&](size_t node) {
+                        return std::pair{linksToOrdered[node], degrees[node]};
+                    });
+                std::iter_swap(level.begin() +
+                                   static_cast<std::ptrdiff_t>(placed),
+                               best);
+
+                const auto node = level[placed];
+                order.emplace_back(node);
+                for (size_t other = 0; other < patternSize; other++)
+                {
+                    if (pattern.areAdjacent(node, other))
+                        linksToOrdered[other]++;
+                }
+            }
+
+            nextLevel.clear();
+            for (const auto node : level)
+            {
+                for (size_t other = 0; other < patternSize; other++)
+                {
+                    if (!reached[other] && pattern.areAdjacent(node, other))
+                    {
+                        reached[other] = true;
+                        nextLevel.emplace_back(other);
+                    }
+                }
+            }
+            std::swap(level, nextLevel);
+        }
+    }
+
+    requiredDegrees.resize(patternSize);
+    parents.assign(patternSize, NO_PARENT);
+    linkedPositions.resize(patternSize);
+    unlinkedPositions.resize(patternSize);
+    for (size_t position = 0; position < patternSize; position++)
+    {
+        const auto node = order[position];
+        requiredDegrees[position] = degrees[node];
+        for (size_t earlier = 0; earlier < position; earlier++)
+        {
+            if (!pattern.areAdjacent(node, order[earlier]))
+                unlinkedPositions[position].emplace_back(earlier);
+            else if (parents[position] == NO_PARENT)
+                parents[position] = earlier;
+            else
+                linkedPositions[position].emplace_back(earlier);
+        }
+    }
+}
+
+template <typename IndexType>
+constexpr size_t SubgraphMatcher<IndexType>::getNumberOfWorkers() const
+{
+    return numberOfWorkers(rootCandidates.size());
+}
+
+template <typename IndexType>
+template <typename Callback>
+constexpr void SubgraphMatcher<IndexType>::forEachEmbedding(
+    Callback &&onEmbedding) const
+{
+    if (patternSize == 0)
+        return;
+
+    const auto workers = getNumberOfWorkers();
+    std::vector<std::vector<IndexType>> images(
+        workers, std::vector<IndexType>(patternSize));
+    std::vector<std::vector<IndexType>> mappings(
+        workers, std::vector<IndexType>(patternSize));
+    std::vector<std::vector<size_t>> cursors(
+        workers, std::vector<size_t>(patternSize, 0));
+
+    parallelFor(
+        rootCandidates.size(),
+        [&](size_t worker, size_t task) {
+            auto &image = images[worker];
+            auto &cursor = cursors[worker];
+            auto &mapping = mappings[worker];
+            image[0] = rootCandidates[task];
+
+            // Depth first search on an explicit stack of candidate cursors
+            size_t depth = 1;
+            if (patternSize > 1)
+                cursor[1] = 0;
+            while (depth > 0)
+            {
+                if (depth == patternSize)
+                {
+                    for (size_t position = 0; position < patternSize;
+                         position++)
+                        mapping[order[position]] = image[position];
+                    onEmbedding(worker, std::span<const IndexType>(mapping));
+                    depth--;
+                    continue;
+                }
+
+                const auto candidates =
+                    parents[depth] == NO_PARENT
+                        ? std::span<const IndexType>(allNodes)
+                        : data->getNeighbors(image[parents[depth]]);
+                bool descended = false;
+                while (cursor[depth] < candidates.size())
+                {
+                    const auto candidate = candidates[cursor[depth]++];
+                    if (isFeasible(depth, candidate,
+                                   std::span<const IndexType>(image).first(
+                                       depth)))
+                    {
+                        image[depth] = candidate;
+                        depth++;
+                        if (depth < patternSize)
+                            cursor[depth] = 0;
+                        descended = true;
+                        break;
+                    }
+                }
+                if (!descended)
+                    depth--;
+            }
+        },
+        16);
+}
+
+template <typename IndexType>
+constexpr bool SubgraphMatcher<IndexType>::isFeasible(
+    size_t position, IndexType candidate,
+    std::span<const IndexType> images) const
+{
+    if (data->getDegree(candidate) < requiredDegrees[position] ||
+        std::ranges::find(images, candidate) != images.end())
+        return false;
+
+    for (const auto earlier : linkedPositions[position])
+    {
+        if (!data->containsNeighbor(images[earlier], candidate))
+            return false;
+    }
+    if (induced)
+    {
+        for (const auto earlier : unlinkedPositions[position])
+        {
+            if (data->containsNeighbor(images[earlier], candidate))
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace jGraph::internals
@@ -3,6 +3,7 @@
 #include "DefaultTypes.hpp"
 #include "DirectedGraphPrimitives.hpp"
 #include "ListGraph.hpp"
+#include "Parallel.hpp"
 
 #include <algorithm>
 #include <cstddef>
@@ -25,10 +26,14 @@ class DirectedListGraph : public ListGraph<T, IndexType>,
 
     [[nodiscard]] constexpr bool isDirected() const override;
 
+    constexpr void removeNode(T nodeName) override;
+    constexpr void removeNode(std::span<T> nodes) override;
+
     constexpr void addEdge(std::pair<T, T> edge) override;
     constexpr void addEdge(std::span<std::pair<T, T>> edges) override;
 
     constexpr void removeEdge(std::pair<T, T> edge) override;
+    constexpr void removeEdge(std::span<std::pair<T, T>> edges) override;
 
     [[nodiscard]] constexpr std::vector<std::pair<T, T>> getEdges()
         const override;
@@ -40,12 +45,24 @@ class DirectedListGraph : public ListGraph<T, IndexType>,
         T key) const override;
 
   private:
+    // Whether the arc to -> from exists, a self-loop not being its own
+    // reverse arc
+    [[nodiscard]] constexpr bool internal_hasReverseArc(IndexType from,
+                                                        IndexType to) const;
+
     [[nodiscard]] constexpr std::vector<IndexType> internal_getNeighbors(
         IndexType index) const override;
     [[nodiscard]] constexpr std::vector<IndexType>
     internal_getOutgoingNeighbors(IndexType index) const override;
     [[nodiscard]] constexpr std::vector<IndexType> internal_getIngoingNeighbors(
         IndexType index) const override;
+    [[nodiscard]] constexpr std::vector<std::pair<IndexType, double>>
+    internal_getWeightedNeighbors(IndexType index) const override;
+    // Merges every outgoing list with the matching row of their transpose,
+    // in parallel, instead of scanning every list for the ingoing arcs of
+    // every node
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_compressNeighbors() const override;
 };
 
 template <typename T, typename IndexType>
@@ -55,7 +72,10 @@ constexpr DirectedListGraph<T, IndexType>::DirectedListGraph(
     for (const auto &node : newNodes)
     {
         if (this->getNodeMap().addByName(node))
+        {
             this->getAdjacencyList().emplace_back();
+            this->getDegreeCounters().addNodes(1);
+        }
     }
 }
 
@@ -78,14 +98,13 @@ constexpr void DirectedListGraph<T, IndexType>::addEdge(std::pair<T, T> edge)
     const auto firstIndex = this->getNodeMap().convertNodeNameToIndex(first);
     const auto secondIndex = this->getNodeMap().convertNodeNameToIndex(second);
 
-    if (!std::ranges::contains(
-            this->getAdjacencyList().at(static_cast<size_t>(firstIndex)),
-            secondIndex))
+    if (!this->internal_containsNeighbor(firstIndex, secondIndex))
     {
         this->getEdgeNumber()++;
-        this->getAdjacencyList()
-            .at(static_cast<size_t>(firstIndex))
-            .push_back(secondIndex);
+        this->internal_insertNeighbor(firstIndex, secondIndex);
+        this->getDegreeCounters().addArc(
+            firstIndex, secondIndex,
+            internal_hasReverseArc(firstIndex, secondIndex));
     }
 }
 
@@ -108,6 +127,28 @@ constexpr void DirectedListGraph<T, IndexType>::addEdge(
 
     auto &adjaList = this->getAdjacencyList();
     adjaList.resize(adjaList.size() + addedNodesCount);
+    this->getDegreeCounters().addNodes(addedNodesCount);
+
+    if (this->isAdjacencySorted())
+    {
+        const auto addedArcs = this->internal_mergeArcs(
+            this->getNodeMap().convertNodeNameToIndex(edges));
+
+        // Arcs are counted in sorted order, so the reverse of an arc only
+        // links both nodes already if it was there before the batch or
+        // comes first
+        for (const auto &[from, to] : addedArcs)
+        {
+            this->getEdgeNumber()++;
+            const auto reverseArc =
+                internal_hasReverseArc(from, to) &&
+                !(from < to &&
+                  std::ranges::binary_search(addedArcs, std::pair(to, from)));
+            this->getDegreeCounters().addArc(from, to, reverseArc);
+        }
+        return;
+    }
+
     for (const auto &edge : edges)
     {
 
@@ -116,11 +157,13 @@ constexpr void DirectedListGraph<T, IndexType>::addEdge(
         const auto secondIndex =
             this->getNodeMap().convertNodeNameToIndex(edge.second);
 
-        if (!std::ranges::contains(adjaList.at(static_cast<size_t>(firstIndex)),
-                                   secondIndex))
+        if (!this->internal_containsNeighbor(firstIndex, secondIndex))
         {
             this->getEdgeNumber()++;
-            adjaList.at(static_cast<size_t>(firstIndex)).push_back(secondIndex);
+            this->internal_insertNeighbor(firstIndex, secondIndex);
+            this->getDegreeCounters().addArc(
+                firstIndex, secondIndex,
+                internal_hasReverseArc(firstIndex, secondIndex));
         }
     }
 }
@@ -128,15 +171,118 @@ constexpr void DirectedListGraph<T, IndexType>::addEdge(
 template <typename T, typename IndexType>
 constexpr void DirectedListGraph<T, IndexType>::removeEdge(std::pair<T, T> edge)
 {
-    const auto first = static_cast<size_t>(
-        this->getNodeMap().convertNodeNameToIndex(edge.first));
-    const auto second = static_cast<size_t>(
-        this->getNodeMap().convertNodeNameToIndex(edge.second));
+    const auto [from, to] = this->getNodeMap().convertNodeNameToIndex(edge);
 
-    auto &edgesOfFirst = this->getAdjacencyList().at(first);
-    bool edgeRemoved = (std::erase(edgesOfFirst, second) == 1);
-    if (edgeRemoved)
+    if (this->internal_eraseNeighbor(from, to) == 1)
+    {
         this->getEdgeNumber()--;
+        this->getDegreeCounters().removeArc(from, to,
+                                            internal_hasReverseArc(from, to));
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr void DirectedListGraph<T, IndexType>::removeEdge(
+    std::span<std::pair<T, T>> edges)
+{
+    std::vector<std::pair<IndexType, IndexType>> arcs;
+    arcs.reserve(edges.size());
+    for (const auto &edge : edges)
+    {
+        if (this->getNodeMap().contains(edge.first) &&
+            this->getNodeMap().contains(edge.second))
+            arcs.emplace_back(this->getNodeMap().convertNodeNameToIndex(edge));
+    }
+
+    // Counted as if removed one by one in order, so an arc still sees its
+    // reverse arc if that one comes later in the batch
+    const auto removedArcs = this->internal_eraseArcs(std::move(arcs));
+    for (const auto &[from, to] : removedArcs)
+    {
+        const auto reverseArc =
+            internal_hasReverseArc(from, to) ||
+            (to > from &&
+             std::ranges::binary_search(removedArcs, std::pair(to, from)));
+        this->getEdgeNumber()--;
+        this->getDegreeCounters().removeArc(from, to, reverseArc);
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr void DirectedListGraph<T, IndexType>::removeNode(T nodeName)
+{
+    if (!this->getNodeMap().contains(nodeName))
+        return;
+
+    const auto index = this->getNodeMap().convertNodeNameToIndex(nodeName);
+    const auto &nodes = this->getAdjacencyList();
+    const auto last = static_cast<IndexType>(nodes.size() - 1);
+    auto &counters = this->getDegreeCounters();
+
+    // Arcs towards the node first, each still seeing its reverse arc, then
+    // the arcs out of it, whose reverse arcs are already gone. Arcs towards
+    // the last node are renamed in the same pass, no list of incoming arcs
+    // being kept.
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        const auto node = static_cast<IndexType>(i);
+        if (node == index)
+            continue;
+        if (this->internal_containsNeighbor(node, index))
+        {
+            this->getEdgeNumber()--;
+            counters.removeArc(node, index,
+                               this->internal_containsNeighbor(index, node));
+            this->internal_eraseNeighbor(node, index);
+        }
+        if (index != last && this->internal_containsNeighbor(node, last))
+            this->internal_renameNeighbor(node, last, index);
+    }
+    for (const auto neighbor : nodes[static_cast<size_t>(index)])
+    {
+        this->getEdgeNumber()--;
+        counters.removeArc(index, neighbor, false);
+    }
+    this->internal_eraseNode(index);
+    this->getNodeMap().removeByName(nodeName);
+}
+
+template <typename T, typename IndexType>
+constexpr void DirectedListGraph<T, IndexType>::removeNode(std::span<T> nodes)
+{
+    const auto &rows = this->getAdjacencyList();
+    const auto newIndexes =
+        this->getNodeMap().removeByName(std::span<const T>(nodes));
+    if (this->getNodeMap().getSize() == rows.size())
+        return;
+
+    // Arcs out of removed nodes, the remaining nodes they point to staying
+    // linked to them through their own arcs until the lists are rewritten
+    constexpr auto removed =
+        internals::NameIndexMap<T, IndexType>::REMOVED_INDEX;
+    for (size_t node = 0; node < rows.size(); node++)
+    {
+        if (newIndexes[node] != removed)
+            continue;
+        for (const auto neighbor : rows[node])
+        {
+            this->getEdgeNumber()--;
+            if (newIndexes[static_cast<size_t>(neighbor)] == removed)
+                continue;
+            const auto linked = this->internal_containsNeighbor(
+                neighbor, static_cast<IndexType>(node));
+            this->getDegreeCounters().removeLinks(neighbor, linked ? 0 : 1, 1,
+                                                  0);
+        }
+    }
+    this->getEdgeNumber() -= this->internal_eraseNodes(newIndexes);
+}
+
+template <typename T, typename IndexType>
+constexpr bool DirectedListGraph<T, IndexType>::internal_hasReverseArc(
+    IndexType from, IndexType to) const
+{
+    return from != to && this->internal_containsNeighbor(to, from);
 }
 
 template <typename T, typename IndexType>
@@ -176,13 +322,13 @@ constexpr std::vector<IndexType> DirectedListGraph<
 {
     std::unordered_set<IndexType> resultSet;
 
-    auto nodes = this->getAdjacencyList();
+    const auto &nodes = this->getAdjacencyList();
     for (size_t i = 0; i < nodes.size(); i++)
     {
         if (static_cast<IndexType>(i) == index)
             continue;
 
-        if (std::ranges::contains(nodes.at(i), index))
+        if (this->internal_containsNeighbor(static_cast<IndexType>(i), index))
             resultSet.emplace(static_cast<IndexType>(i));
     }
 
@@ -195,6 +341,92 @@ constexpr std::vector<IndexType> DirectedListGraph<
     return result;
 }
 
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> DirectedListGraph<
+    T, IndexType>::internal_compressNeighbors() const
+{
+    const auto &rows = this->getAdjacencyList();
+    const auto numberOfNodes = rows.size();
+
+    // Ingoing lists, filled by increasing source so that they come sorted
+    std::vector<size_t> inOffsets(numberOfNodes + 1, 0);
+    for (size_t from = 0; from < numberOfNodes; from++)
+    {
+        for (const auto to : rows[from])
+        {
+            if (static_cast<size_t>(to) != from)
+                inOffsets[static_cast<size_t>(to) + 1]++;
+        }
+    }
+    for (size_t node = 0; node < numberOfNodes; node++)
+        inOffsets[node + 1] += inOffsets[node];
+
+    std::vector<IndexType> inNeighbors(inOffsets.back());
+    auto inEnds = inOffsets;
+    for (size_t from = 0; from < numberOfNodes; from++)
+    {
+        for (const auto to : rows[from])
+        {
+            if (static_cast<size_t>(to) != from)
+                inNeighbors[inEnds[static_cast<size_t>(to)]++] =
+                    static_cast<IndexType>(from);
+        }
+    }
+
+    // Rows are merged into room for both of their lists, then packed
+    std::vector<size_t> mergedOffsets(numberOfNodes + 1, 0);
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        mergedOffsets[node + 1] = mergedOffsets[node] + rows[node].size() +
+                                  inOffsets[node + 1] - inOffsets[node];
+    }
+    std::vector<IndexType> merged(mergedOffsets.back());
+    std::vector<size_t> rowSizes(numberOfNodes);
+    std::vector<std::vector<IndexType>> sortedRows(
+        internals::numberOfWorkers(numberOfNodes));
+    internals::parallelFor(
+        numberOfNodes,
+        [&](size_t worker, size_t node) {
+            std::span<const IndexType> outgoing = rows[node];
+            if (!std::ranges::is_sorted(outgoing))
+            {
+                sortedRows[worker].assign(outgoing.begin(), outgoing.end());
+                std::ranges::sort(sortedRows[worker]);
+                outgoing = sortedRows[worker];
+            }
+            const auto ingoing = std::span<const IndexType>(inNeighbors)
+                                     .subspan(inOffsets[node],
+                                              inOffsets[node + 1] -
+                                                  inOffsets[node]);
+            const auto begin =
+                merged.begin() +
+                static_cast<std::ptrdiff_t>(mergedOffsets[node]);
+            const auto end =
+                std::ranges::set_union(outgoing, ingoing, begin).out;
+            rowSizes[node] = static_cast<size_t>(end - begin);
+        },
+        256);
+
+    std::vector<size_t> offsets(numberOfNodes + 1, 0);
+    for (size_t node = 0; node < numberOfNodes; node++)
+        offsets[node + 1] = offsets[node] + rowSizes[node];
+
+    std::vector<IndexType> neighbors(offsets.back());
+    internals::parallelFor(
+        numberOfNodes,
+        [&](size_t, size_t node) {
+            const auto begin =
+                merged.begin() +
+                static_cast<std::ptrdiff_t>(mergedOffsets[node]);
+            std::copy(begin,
+                      begin + static_cast<std::ptrdiff_t>(rowSizes[node]),
+                      neighbors.begin() +
+                          static_cast<std::ptrdiff_t>(offsets[node]));
+        },
+        256);
+    return {std::move(offsets), std::move(neighbors)};
+}
+
 template <typename T, typename IndexType>
 constexpr std::vector<T> DirectedListGraph<T, IndexType>::getOutgoingNeighbors(
     T key) const
@@ -211,6 +443,22 @@ constexpr std::vector<IndexType> DirectedListGraph<
     return this->getAdjacencyList().at(static_cast<size_t>(index));
 }
 
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<IndexType, double>> DirectedListGraph<
+    T, IndexType>::internal_getWeightedNeighbors(IndexType index) const
+{
+    std::vector<std::pair<IndexType, double>> result;
+    const auto &outgoing =
+        this->getAdjacencyList().at(static_cast<size_t>(index));
+    result.reserve(outgoing.size());
+
+    for (const auto neighbor : outgoing)
+    {
+        result.emplace_back(neighbor, 1.0);
+    }
+    return result;
+}
+
 template <typename T, typename IndexType>
 constexpr std::vector<T> DirectedListGraph<T, IndexType>::getIngoingNeighbors(
     T key) const
@@ -227,13 +475,13 @@ constexpr std::vector<IndexType> DirectedListGraph<
     std::vector<IndexType> result;
     result.reserve(this->getNumberOfNodes());
 
-    auto nodes = this->getAdjacencyList();
+    const auto &nodes = this->getAdjacencyList();
     for (size_t i = 0; i < nodes.size(); i++)
     {
         if (static_cast<IndexType>(i) == index)
             continue;
 
-        if (std::ranges::contains(nodes.at(i), index))
+        if (this->internal_containsNeighbor(static_cast<IndexType>(i), index))
             result.emplace_back(static_cast<IndexType>(i));
     }
     result.shrink_to_fit();
@@ -29,6 +29,11 @@ class DirectedMatrixGraph : public MatrixGraph<T, IndexType>,
 
     [[nodiscard]] constexpr bool isDirected() const override;
 
+    // Batch removals of MatrixGraph handle arcs already
+    using MatrixGraph<T, IndexType>::removeNode;
+    using MatrixGraph<T, IndexType>::removeEdge;
+    constexpr void removeNode(T nodeName) override;
+
     constexpr void addEdge(std::pair<T, T> edge) override;
     constexpr void addEdge(std::span<std::pair<T, T>> edges) override;
     constexpr void removeEdge(std::pair<T, T> edge) override;
@@ -44,6 +49,9 @@ class DirectedMatrixGraph : public MatrixGraph<T, IndexType>,
     constexpr bool hasEdge(std::pair<T, T> edge) const override;
 
   private:
+    // Sets the cell of an arc that is not already set to the value
+    constexpr void internal_setArc(size_t from, size_t to, IndexType value);
+
     [[nodiscard]] constexpr std::vector<IndexType> internal_getNeighbors(
         IndexType index) const override;
 
@@ -51,6 +59,8 @@ class DirectedMatrixGraph : public MatrixGraph<T, IndexType>,
     internal_getOutgoingNeighbors(IndexType index) const override;
     [[nodiscard]] constexpr std::vector<IndexType> internal_getIngoingNeighbors(
         IndexType index) const override;
+    [[nodiscard]] constexpr std::vector<std::pair<IndexType, double>>
+    internal_getWeightedNeighbors(IndexType index) const override;
 };
 
 template <typename T, typename IndexType>
@@ -67,6 +77,7 @@ constexpr DirectedMatrixGraph<T, IndexType>::DirectedMatrixGraph(
             }
             this->getEdgeMatrix().emplace_back(this->getEdgeMatrix().size() + 1,
                                                false);
+            this->getDegreeCounters().addNodes(1);
         }
     }
 }
@@ -87,6 +98,7 @@ constexpr DirectedMatrixGraph<T, IndexType>::DirectedMatrixGraph(
             }
             this->getEdgeMatrix().emplace_back(this->getEdgeMatrix().size() + 1,
                                                false);
+            this->getDegreeCounters().addNodes(1);
         }
     }
 }
@@ -115,7 +127,7 @@ constexpr void DirectedMatrixGraph<T, IndexType>::addEdge(std::pair<T, T> edge)
     if (this->getEdgeMatrix().at(firstIndex).at(secondIndex) == this->NOT_EDGE)
     {
         this->getEdgeNumber()++;
-        this->getEdgeMatrix()[firstIndex][secondIndex] = this->EDGE;
+        internal_setArc(firstIndex, secondIndex, this->EDGE);
     }
 }
 
@@ -143,6 +155,7 @@ constexpr void DirectedMatrixGraph<T, IndexType>::addEdge(
     }
     this->getEdgeMatrix().resize(
         newMatrixSize, std::vector<IndexType>(newMatrixSize, this->NOT_EDGE));
+    this->getDegreeCounters().addNodes(addedNodesCount);
 
     const auto edgesOfIndexes =
         this->getNodeMap().convertNodeNameToIndex(edges);
@@ -156,7 +169,7 @@ constexpr void DirectedMatrixGraph<T, IndexType>::addEdge(
             this->NOT_EDGE)
         {
             this->getEdgeNumber()++;
-            this->getEdgeMatrix()[firstIndex][secondIndex] = this->EDGE;
+            internal_setArc(firstIndex, secondIndex, this->EDGE);
         }
     }
 }
@@ -173,7 +186,54 @@ constexpr void DirectedMatrixGraph<T, IndexType>::removeEdge(
     if (this->getEdgeMatrix().at(first).at(second) == this->EDGE)
     {
         this->getEdgeNumber()--;
-        this->getEdgeMatrix()[first][second] = this->NOT_EDGE;
+        internal_setArc(first, second, this->NOT_EDGE);
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr void DirectedMatrixGraph<T, IndexType>::removeNode(T nodeName)
+{
+    if (!this->getNodeMap().contains(nodeName))
+        return;
+
+    const auto index = static_cast<size_t>(
+        this->getNodeMap().convertNodeNameToIndex(nodeName));
+    auto &matrix = this->getEdgeMatrix();
+    for (size_t i = 0; i < matrix.size(); i++)
+    {
+        for (const auto &[from, to] :
+             {std::pair(i, index), std::pair(index, i)})
+        {
+            if (matrix[from][to] == this->EDGE)
+            {
+                this->getEdgeNumber()--;
+                internal_setArc(from, to, this->NOT_EDGE);
+            }
+        }
+    }
+    this->internal_eraseNode(static_cast<IndexType>(index));
+    this->getNodeMap().removeByName(nodeName);
+}
+
+template <typename T, typename IndexType>
+constexpr void DirectedMatrixGraph<T, IndexType>::internal_setArc(
+    size_t from, size_t to, IndexType value)
+{
+    auto &matrix = this->getEdgeMatrix();
+    matrix[from][to] = value;
+
+    const auto reverseArc = from != to && matrix[to][from] == this->EDGE;
+    if (value == this->EDGE)
+    {
+        this->getDegreeCounters().addArc(static_cast<IndexType>(from),
+                                         static_cast<IndexType>(to),
+                                         reverseArc);
+    }
+    else
+    {
+        this->getDegreeCounters().removeArc(static_cast<IndexType>(from),
+                                            static_cast<IndexType>(to),
+                                            reverseArc);
     }
 }
 
@@ -258,6 +318,21 @@ constexpr std::vector<IndexType> DirectedMatrixGraph<
     return result;
 }
 
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<IndexType, double>> DirectedMatrixGraph<
+    T, IndexType>::internal_getWeightedNeighbors(IndexType index) const
+{
+    std::vector<std::pair<IndexType, double>> result;
+    const auto &row = this->getEdgeMatrix().at(static_cast<size_t>(index));
+
+    for (size_t i = 0; i < row.size(); i++)
+    {
+        if (row[i] == this->EDGE)
+            result.emplace_back(static_cast<IndexType>(i), 1.0);
+    }
+    return result;
+}
+
 template <typename T, typename IndexType>
 constexpr std::vector<T> DirectedMatrixGraph<T, IndexType>::getIngoingNeighbors(
     T key) const
@@ -2,13 +2,18 @@
 
 #include "DefaultTypes.hpp"
 #include "GraphAlgorithms.hpp"
+#include "GraphBuilder.hpp"
 #include "GraphMeasures.hpp"
 #include "GraphPrimitives.hpp"
 #include "GraphSerialization.hpp"
+#include "NeighborHashSet.hpp"
+#include "Parallel.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <numeric>
 #include <ranges>
 #include <span>
 #include <utility>
@@ -21,6 +26,7 @@ template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
 class ListGraph : public GraphAlgorithms<T, IndexType>,
                   public GraphMeasures<T, IndexType>,
                   public GraphSerialization<T, IndexType>,
+                  public GraphBuilder<T, IndexType>,
                   public virtual GraphPrimitives<T, IndexType>
 {
   public:
@@ -37,10 +43,12 @@ class ListGraph : public GraphAlgorithms<T, IndexType>,
     constexpr void addNode(T nodeName) override;
     constexpr void addNode(std::span<T> nodes) override;
     constexpr void removeNode(T nodeName) override;
+    constexpr void removeNode(std::span<T> nodes) override;
 
     constexpr void addEdge(std::pair<T, T> edge) override;
     constexpr void addEdge(std::span<std::pair<T, T>> edges) override;
     constexpr void removeEdge(std::pair<T, T> edge) override;
+    constexpr void removeEdge(std::span<std::pair<T, T>> edges) override;
 
     [[nodiscard]] constexpr size_t getNumberOfNodes() const override;
     [[nodiscard]] constexpr size_t getNumberOfEdges() const override;
@@ -51,6 +59,19 @@ class ListGraph : public GraphAlgorithms<T, IndexType>,
 
     constexpr bool hasEdge(std::pair<T, T> edge) const override;
 
+    // Keeps every neighbor list sorted, so that edge lookups binary search
+    // them and edge batches are merged into them once per batch instead of
+    // searched edge by edge. Turning it on sorts the current lists.
+    constexpr void setSortedAdjacency(bool sorted);
+    [[nodiscard]] constexpr bool isAdjacencySorted() const;
+
+    // Nodes with more neighbors than the threshold also keep them in a hash
+    // set, making edge lookups and inserts on them constant time on average
+    // whatever their degree, and drop it once they fall under half of it.
+    // The largest threshold turns hubs off.
+    constexpr void setHubThreshold(size_t threshold);
+    [[nodiscard]] constexpr size_t getHubThreshold() const;
+
   protected:
     constexpr std::vector<std::vector<IndexType>> &getAdjacencyList();
     constexpr const std::vector<std::vector<IndexType>> &getAdjacencyList()
@@ -59,16 +80,64 @@ class ListGraph : public GraphAlgorithms<T, IndexType>,
     constexpr size_t &getEdgeNumber();
     [[nodiscard]] constexpr size_t getEdgeNumber() const;
 
+    // Drops the node, whose entries must be gone from the other neighbor
+    // lists, and moves the last node to its index so that no other index
+    // changes. Renaming the last node in the lists of the nodes linked to it
+    // is left to the caller, its own self-loop aside.
+    constexpr void internal_eraseNode(IndexType index);
+    // Drops the removed nodes, the ones with REMOVED_INDEX as new index,
+    // from the neighbor lists of the other nodes and renames them, every
+    // list being rewritten once and in parallel. Remaining nodes lose the
+    // dropped arcs in the degree counters, the arcs of removed nodes being
+    // left to the caller. Returns the number of dropped arcs.
+    constexpr size_t internal_eraseNodes(std::span<const IndexType> newIndexes);
+
+    [[nodiscard]] constexpr bool internal_containsNeighbor(
+        IndexType node, IndexType neighbor) const;
+    constexpr void internal_insertNeighbor(IndexType node, IndexType neighbor);
+    // Removes every entry of the neighbor from the neighbors of the node and
+    // returns how many there were
+    constexpr size_t internal_eraseNeighbor(IndexType node, IndexType neighbor);
+    // Renames every entry of the neighbor in the neighbors of the node to a
+    // smaller index
+    constexpr void internal_renameNeighbor(IndexType node, IndexType neighbor,
+                                           IndexType newNeighbor);
+
+    // Adds the arcs missing from sorted neighbor lists, each list being
+    // merged with its new arcs in one go. Returns the added arcs, sorted.
+    constexpr std::vector<std::pair<IndexType, IndexType>> internal_mergeArcs(
+        std::vector<std::pair<IndexType, IndexType>> arcs);
+    // Removes the arcs found in the neighbor lists, each list being
+    // rewritten once. Returns the removed arcs, sorted.
+    constexpr std::vector<std::pair<IndexType, IndexType>> internal_eraseArcs(
+        std::vector<std::pair<IndexType, IndexType>> arcs);
+
   private:
     size_t edgeNumber = 0;
     std::vector<std::vector<IndexType>> adjacencyList;
+    bool sortedAdjacency = false;
+
+    static constexpr size_t DEFAULT_HUB_THRESHOLD = 64;
+    size_t hubThreshold = DEFAULT_HUB_THRESHOLD;
+    // Neighbors of the hubs, empty for the other nodes and missing past the
+    // last hub
+    std::vector<internals::NeighborHashSet<IndexType>> hubNeighbors;
+
+    [[nodiscard]] constexpr bool internal_isHub(IndexType node) const;
+    // Promotes the node to a hub or demotes it depending on its degree
+    constexpr void internal_updateHub(IndexType node);
 
     constexpr std::vector<IndexType> internal_getNodes() const override;
     constexpr std::vector<IndexType> internal_getNeighbors(
         IndexType index) const override;
+    // Copies the neighbor lists as they are, in parallel
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_compressNeighbors() const override;
 
     void internal_assignParsedData(
         internals::parsedGraph<T> &parsedData) override;
+    void internal_assignBuiltAdjacency(
+        const internals::builtAdjacency<IndexType> &adjacency) override;
 };
 
 template <typename T, typename IndexType>
@@ -81,7 +150,10 @@ constexpr
     for (const auto &node : rangeOfNodes)
     {
         if (this->getNodeMap().addByName(node))
+        {
             adjacencyList.emplace_back();
+            this->getDegreeCounters().addNodes(1);
+        }
     }
 }
 
@@ -91,6 +163,7 @@ constexpr void ListGraph<T, IndexType>::addNode(T nodeName)
     if (this->getNodeMap().addByName(nodeName))
     {
         adjacencyList.emplace_back();
+        this->getDegreeCounters().addNodes(1);
     }
 }
 
@@ -108,6 +181,7 @@ constexpr void ListGraph<T, TypeIndex>::addNode(std::span<T> newNodes)
 
     const auto newSize = adjacencyList.size() + nodesToAdd.size();
     adjacencyList.resize(newSize);
+    this->getDegreeCounters().addNodes(nodesToAdd.size());
 }
 
 template <typename T, typename IndexType>
@@ -128,21 +202,141 @@ constexpr void ListGraph<T, IndexType>::removeNode(T nodeName)
     if (!this->getNodeMap().contains(nodeName))
         return;
 
-    const auto associatedEdgesNumber = this->getNeighbors(nodeName).size();
-    edgeNumber -= associatedEdgesNumber;
-
     const auto index = this->getNodeMap().convertNodeNameToIndex(nodeName);
-    adjacencyList.erase(adjacencyList.begin() + index);
+    const auto last = static_cast<IndexType>(adjacencyList.size() - 1);
+
+    // Only the neighbors of the node and of the last node are touched, a
+    // self-loop being listed twice
+    bool selfLoop = false;
+    for (const auto neighbor : adjacencyList[static_cast<size_t>(index)])
+    {
+        if (neighbor == index)
+        {
+            selfLoop = true;
+            continue;
+        }
+        internal_eraseNeighbor(neighbor, index);
+        this->getDegreeCounters().removeNeighbor(neighbor);
+        edgeNumber--;
+    }
+    if (selfLoop)
+        edgeNumber--;
+
+    if (index != last)
+    {
+        for (const auto neighbor : adjacencyList[static_cast<size_t>(last)])
+        {
+            if (neighbor != last)
+                internal_renameNeighbor(neighbor, last, index);
+        }
+    }
+    internal_eraseNode(index);
+    this->getNodeMap().removeByName(nodeName);
+}
 
-    for (auto &node : adjacencyList)
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::removeNode(std::span<T> nodes)
+{
+    const auto newIndexes =
+        this->getNodeMap().removeByName(std::span<const T>(nodes));
+    if (this->getNodeMap().getSize() == adjacencyList.size())
+        return;
+
+    // Edges between removed nodes are counted from their smaller end, a
+    // self-loop being listed twice
+    constexpr auto removed =
+        internals::NameIndexMap<T, IndexType>::REMOVED_INDEX;
+    size_t selfLoopEntries = 0;
+    for (size_t node = 0; node < adjacencyList.size(); node++)
     {
-        node.erase(std::ranges::remove(node, index).begin(), node.end());
-        for (auto &edge : node)
+        if (newIndexes[node] != removed)
+            continue;
+        for (const auto neighbor : adjacencyList[node])
         {
-            if (edge > index)
-                edge--;
+            const auto other = static_cast<size_t>(neighbor);
+            if (other == node)
+                selfLoopEntries++;
+            else if (other > node && newIndexes[other] == removed)
+                edgeNumber--;
         }
     }
+    edgeNumber -= selfLoopEntries / 2;
+    edgeNumber -= internal_eraseNodes(newIndexes);
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::internal_eraseNode(IndexType index)
+{
+    const auto position = static_cast<size_t>(index);
+    const auto last = adjacencyList.size() - 1;
+    if (position != last)
+    {
+        adjacencyList[position] = std::move(adjacencyList[last]);
+        if (position < hubNeighbors.size())
+            hubNeighbors[position] = {};
+        if (last < hubNeighbors.size())
+            hubNeighbors[position] = std::move(hubNeighbors[last]);
+        internal_renameNeighbor(index, static_cast<IndexType>(last), index);
+    }
+    adjacencyList.pop_back();
+    if (hubNeighbors.size() > adjacencyList.size())
+        hubNeighbors.resize(adjacencyList.size());
+    this->getDegreeCounters().removeNode(index);
+}
+
+template <typename T, typename IndexType>
+constexpr size_t ListGraph<T, IndexType>::internal_eraseNodes(
+    std::span<const IndexType> newIndexes)
+{
+    constexpr auto removed =
+        internals::NameIndexMap<T, IndexType>::REMOVED_INDEX;
+    const auto directed = this->isDirected();
+    auto &counters = this->getDegreeCounters();
+    if (hubNeighbors.size() < adjacencyList.size())
+        hubNeighbors.resize(adjacencyList.size());
+
+    // Rows only touch their own counters and hub set. New indexes keep the
+    // order of the old ones, so sorted lists stay sorted.
+    std::vector<size_t> droppedArcs(
+        internals::numberOfWorkers(adjacencyList.size()), 0);
+    internals::parallelFor(
+        adjacencyList.size(),
+        [&](size_t worker, size_t node) {
+            if (newIndexes[node] == removed)
+                return;
+            auto &neighbors = adjacencyList[node];
+            const auto dropped =
+                std::erase_if(neighbors, [&](IndexType neighbor) {
+                    return newIndexes[static_cast<size_t>(neighbor)] ==
+                           removed;
+                });
+            for (auto &neighbor : neighbors)
+                neighbor = newIndexes[static_cast<size_t>(neighbor)];
+
+            counters.removeLinks(static_cast<IndexType>(node), dropped,
+                                 directed ? 0 : dropped, dropped);
+            droppedArcs[worker] += dropped;
+            hubNeighbors[node] = {};
+            internal_updateHub(static_cast<IndexType>(node));
+        },
+        64);
+
+    size_t remainingNodes = 0;
+    for (size_t node = 0; node < adjacencyList.size(); node++)
+    {
+        if (newIndexes[node] == removed)
+            continue;
+        if (remainingNodes != node)
+        {
+            adjacencyList[remainingNodes] = std::move(adjacencyList[node]);
+            hubNeighbors[remainingNodes] = std::move(hubNeighbors[node]);
+        }
+        remainingNodes++;
+    }
+    adjacencyList.resize(remainingNodes);
+    hubNeighbors.resize(remainingNodes);
+    counters.removeNodes(newIndexes, remainingNodes);
+    return std::accumulate(droppedArcs.begin(), droppedArcs.end(), size_t{0});
 }
 
 template <typename T, typename IndexType>
@@ -158,14 +352,12 @@ constexpr void ListGraph<T, IndexType>::addEdge(std::pair<T, T> edge)
     const auto firstIndex = this->getNodeMap().convertNodeNameToIndex(first);
     const auto secondIndex = this->getNodeMap().convertNodeNameToIndex(second);
 
-    if (!std::ranges::contains(
-            adjacencyList.at(static_cast<size_t>(firstIndex)), secondIndex))
-
+    if (!internal_containsNeighbor(firstIndex, secondIndex))
     {
-        adjacencyList.at(static_cast<size_t>(firstIndex))
-            .emplace_back(secondIndex);
-        adjacencyList.at(static_cast<size_t>(secondIndex))
-            .emplace_back(firstIndex);
+        internal_insertNeighbor(firstIndex, secondIndex);
+        internal_insertNeighbor(secondIndex, firstIndex);
+        this->getDegreeCounters().addNeighbor(firstIndex);
+        this->getDegreeCounters().addNeighbor(secondIndex);
         edgeNumber++;
     }
 }
@@ -188,6 +380,33 @@ constexpr void ListGraph<T, IndexType>::addEdge(
     this->getNodeMap().shrinkToFit();
 
     adjacencyList.resize(adjacencyList.size() + addedNodesCount);
+    this->getDegreeCounters().addNodes(addedNodesCount);
+
+    if (sortedAdjacency)
+    {
+        std::vector<std::pair<IndexType, IndexType>> arcs;
+        arcs.reserve(2 * edges.size());
+        for (const auto &[first, second] :
+             this->getNodeMap().convertNodeNameToIndex(edges))
+        {
+            arcs.emplace_back(first, second);
+            arcs.emplace_back(second, first);
+        }
+
+        // Every new edge comes with both of its arcs, and a self-loop is
+        // listed twice in the neighbors of its node
+        for (const auto &[from, to] : internal_mergeArcs(std::move(arcs)))
+        {
+            if (to < from)
+                continue;
+            edgeNumber++;
+            this->getDegreeCounters().addNeighbor(from);
+            this->getDegreeCounters().addNeighbor(to);
+            if (from == to)
+                internal_insertNeighbor(from, to);
+        }
+        return;
+    }
 
     for (const auto &edge : edges)
     {
@@ -196,14 +415,13 @@ constexpr void ListGraph<T, IndexType>::addEdge(
         const auto &secondIndex =
             this->getNodeMap().convertNodeNameToIndex(edge.second);
 
-        if (!std::ranges::contains(
-                adjacencyList.at(static_cast<size_t>(firstIndex)), secondIndex))
+        if (!internal_containsNeighbor(firstIndex, secondIndex))
         {
             edgeNumber++;
-            adjacencyList.at(static_cast<size_t>(firstIndex))
-                .push_back(secondIndex);
-            adjacencyList.at(static_cast<size_t>(secondIndex))
-                .push_back(firstIndex);
+            internal_insertNeighbor(firstIndex, secondIndex);
+            internal_insertNeighbor(secondIndex, firstIndex);
+            this->getDegreeCounters().addNeighbor(firstIndex);
+            this->getDegreeCounters().addNeighbor(secondIndex);
         }
     }
 }
@@ -211,19 +429,46 @@ constexpr void ListGraph<T, IndexType>::addEdge(
 template <typename T, typename IndexType>
 constexpr void ListGraph<T, IndexType>::removeEdge(std::pair<T, T> edge)
 {
-    const auto first = static_cast<size_t>(
-        this->getNodeMap().convertNodeNameToIndex(edge.first));
-    const auto second = static_cast<size_t>(
-        this->getNodeMap().convertNodeNameToIndex(edge.second));
+    const auto [first, second] =
+        this->getNodeMap().convertNodeNameToIndex(edge);
 
-    auto &vec = adjacencyList.at(first);
-    vec.erase(std::ranges::remove(vec, second).begin(), vec.end());
+    // A self-loop leaves with both of its entries at once
+    if (internal_eraseNeighbor(first, second) == 0)
+        return;
+    if (first != second)
+        internal_eraseNeighbor(second, first);
+
+    this->getDegreeCounters().removeNeighbor(first);
+    this->getDegreeCounters().removeNeighbor(second);
+    edgeNumber--;
+}
 
-    auto &vec2 = adjacencyList.at(second);
-    if (auto it = std::ranges::find(vec2, first); it != vec2.end())
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::removeEdge(
+    std::span<std::pair<T, T>> edges)
+{
+    std::vector<std::pair<IndexType, IndexType>> arcs;
+    arcs.reserve(2 * edges.size());
+    for (const auto &edge : edges)
     {
-        vec2.erase(it);
-        edgeNumber--;
+        if (!this->getNodeMap().contains(edge.first) ||
+            !this->getNodeMap().contains(edge.second))
+            continue;
+        const auto [first, second] =
+            this->getNodeMap().convertNodeNameToIndex(edge);
+        arcs.emplace_back(first, second);
+        if (first != second)
+            arcs.emplace_back(second, first);
+    }
+
+    // Every edge removed both of its arcs, a self-loop its two entries
+    for (const auto &[from, to] : internal_eraseArcs(std::move(arcs)))
+    {
+        this->getDegreeCounters().removeNeighbor(from);
+        if (from == to)
+            this->getDegreeCounters().removeNeighbor(from);
+        if (from <= to)
+            edgeNumber--;
     }
 }
 
@@ -281,6 +526,26 @@ constexpr std::vector<IndexType> ListGraph<T, IndexType>::internal_getNeighbors(
     return adjacencyList.at(static_cast<size_t>(index));
 }
 
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> ListGraph<
+    T, IndexType>::internal_compressNeighbors() const
+{
+    std::vector<size_t> offsets(adjacencyList.size() + 1, 0);
+    for (size_t node = 0; node < adjacencyList.size(); node++)
+        offsets[node + 1] = offsets[node] + adjacencyList[node].size();
+
+    std::vector<IndexType> neighbors(offsets.back());
+    internals::parallelFor(
+        adjacencyList.size(),
+        [&](size_t, size_t node) {
+            std::ranges::copy(adjacencyList[node],
+                              neighbors.begin() +
+                                  static_cast<std::ptrdiff_t>(offsets[node]));
+        },
+        256);
+    return {std::move(offsets), std::move(neighbors)};
+}
+
 template <typename T, typename IndexType>
 constexpr bool ListGraph<T, IndexType>::hasEdge(std::pair<T, T> edge) const
 {
@@ -289,14 +554,260 @@ constexpr bool ListGraph<T, IndexType>::hasEdge(std::pair<T, T> edge) const
     const IndexType second =
         this->getNodeMap().convertNodeNameToIndex(edge.second);
 
-    return std::ranges::contains(adjacencyList.at(static_cast<size_t>(first)),
-                                 second);
+    return internal_containsNeighbor(first, second);
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::setSortedAdjacency(bool sorted)
+{
+    if (sorted && !sortedAdjacency)
+    {
+        internals::parallelFor(
+            adjacencyList.size(),
+            [&](size_t, size_t node) {
+                std::ranges::sort(adjacencyList[node]);
+            },
+            64);
+    }
+    sortedAdjacency = sorted;
+}
+
+template <typename T, typename IndexType>
+constexpr bool ListGraph<T, IndexType>::isAdjacencySorted() const
+{
+    return sortedAdjacency;
+}
+
+template <typename T, typename IndexType>
+constexpr bool ListGraph<T, IndexType>::internal_containsNeighbor(
+    IndexType node, IndexType neighbor) const
+{
+    if (internal_isHub(node))
+        return hubNeighbors[static_cast<size_t>(node)].contains(neighbor);
+
+    const auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    if (sortedAdjacency)
+        return std::ranges::binary_search(neighbors, neighbor);
+    return std::ranges::contains(neighbors, neighbor);
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::internal_insertNeighbor(
+    IndexType node, IndexType neighbor)
+{
+    auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    if (sortedAdjacency)
+        neighbors.insert(std::ranges::upper_bound(neighbors, neighbor),
+                         neighbor);
+    else
+        neighbors.emplace_back(neighbor);
+
+    if (internal_isHub(node))
+        hubNeighbors[static_cast<size_t>(node)].insert(neighbor);
+    else
+        internal_updateHub(node);
+}
+
+template <typename T, typename IndexType>
+constexpr size_t ListGraph<T, IndexType>::internal_eraseNeighbor(
+    IndexType node, IndexType neighbor)
+{
+    auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    size_t removedEntries = 0;
+    if (sortedAdjacency)
+    {
+        const auto range = std::ranges::equal_range(neighbors, neighbor);
+        removedEntries = range.size();
+        neighbors.erase(range.begin(), range.end());
+    }
+    else
+    {
+        removedEntries = std::erase(neighbors, neighbor);
+    }
+
+    if (removedEntries != 0 && internal_isHub(node))
+    {
+        hubNeighbors[static_cast<size_t>(node)].erase(neighbor);
+        internal_updateHub(node);
+    }
+    return removedEntries;
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::internal_renameNeighbor(
+    IndexType node, IndexType neighbor, IndexType newNeighbor)
+{
+    assert(newNeighbor < neighbor);
+    auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    size_t renamedEntries = 0;
+    if (sortedAdjacency)
+    {
+        // The entries move down to where the new index sorts
+        const auto range = std::ranges::equal_range(neighbors, neighbor);
+        renamedEntries = range.size();
+        const auto target =
+            std::upper_bound(neighbors.begin(), range.begin(), newNeighbor);
+        std::rotate(target, range.begin(), range.end());
+        std::fill_n(target, renamedEntries, newNeighbor);
+    }
+    else
+    {
+        for (auto &entry : neighbors)
+        {
+            if (entry == neighbor)
+            {
+                entry = newNeighbor;
+                renamedEntries++;
+            }
+        }
+    }
+
+    if (renamedEntries != 0 && internal_isHub(node))
+    {
+        auto &hub = hubNeighbors[static_cast<size_t>(node)];
+        hub.erase(neighbor);
+        hub.insert(newNeighbor);
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr bool ListGraph<T, IndexType>::internal_isHub(IndexType node) const
+{
+    return static_cast<size_t>(node) < hubNeighbors.size() &&
+           !hubNeighbors[static_cast<size_t>(node)].empty();
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::internal_updateHub(IndexType node)
+{
+    const auto index = static_cast<size_t>(node);
+    const auto degree = adjacencyList[index].size();
+    if (internal_isHub(node))
+    {
+        if (degree < hubThreshold / 2)
+            hubNeighbors[index] = {};
+        return;
+    }
+    if (degree <= hubThreshold)
+        return;
+
+    if (hubNeighbors.size() <= index)
+        hubNeighbors.resize(index + 1);
+    hubNeighbors[index] = internals::NeighborHashSet<IndexType>(
+        std::span<const IndexType>(adjacencyList[index]));
+}
+
+template <typename T, typename IndexType>
+constexpr void ListGraph<T, IndexType>::setHubThreshold(size_t threshold)
+{
+    hubThreshold = threshold;
+    hubNeighbors.clear();
+    for (size_t node = 0; node < adjacencyList.size(); node++)
+        internal_updateHub(static_cast<IndexType>(node));
+}
+
+template <typename T, typename IndexType>
+constexpr size_t ListGraph<T, IndexType>::getHubThreshold() const
+{
+    return hubThreshold;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<IndexType, IndexType>> ListGraph<
+    T, IndexType>::internal_mergeArcs(std::vector<std::pair<IndexType,
+                                                            IndexType>> arcs)
+{
+    internals::parallelSort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    std::erase_if(arcs, [this](const auto &arc) {
+        return internal_containsNeighbor(arc.first, arc.second);
+    });
+
+    std::vector<size_t> rowStarts;
+    for (size_t arc = 0; arc < arcs.size(); arc++)
+    {
+        if (arc == 0 || arcs[arc].first != arcs[arc - 1].first)
+            rowStarts.emplace_back(arc);
+    }
+    rowStarts.emplace_back(arcs.size());
+
+    // Rows only update their own hub set from here on
+    if (hubNeighbors.size() < adjacencyList.size())
+        hubNeighbors.resize(adjacencyList.size());
+
+    internals::parallelFor(rowStarts.size() - 1, [&](size_t, size_t row) {
+        const auto node = arcs[rowStarts[row]].first;
+        auto &neighbors = adjacencyList[static_cast<size_t>(node)];
+        const auto oldSize = static_cast<std::ptrdiff_t>(neighbors.size());
+        for (size_t arc = rowStarts[row]; arc < rowStarts[row + 1]; arc++)
+        {
+            neighbors.emplace_back(arcs[arc].second);
+        }
+        std::inplace_merge(neighbors.begin(), neighbors.begin() + oldSize,
+                           neighbors.end());
+
+        if (internal_isHub(node))
+        {
+            for (size_t arc = rowStarts[row]; arc < rowStarts[row + 1]; arc++)
+                hubNeighbors[static_cast<size_t>(node)].insert(
+                    arcs[arc].second);
+        }
+        else
+        {
+            internal_updateHub(node);
+        }
+    });
+    return arcs;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<IndexType, IndexType>> ListGraph<
+    T, IndexType>::internal_eraseArcs(std::vector<std::pair<IndexType,
+                                                            IndexType>> arcs)
+{
+    internals::parallelSort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    std::erase_if(arcs, [this](const auto &arc) {
+        return !internal_containsNeighbor(arc.first, arc.second);
+    });
+
+    std::vector<size_t> rowStarts;
+    for (size_t arc = 0; arc < arcs.size(); arc++)
+    {
+        if (arc == 0 || arcs[arc].first != arcs[arc - 1].first)
+            rowStarts.emplace_back(arc);
+    }
+    rowStarts.emplace_back(arcs.size());
+
+    // Rows only update their own hub set from here on
+    internals::parallelFor(rowStarts.size() - 1, [&](size_t, size_t row) {
+        const auto rowArcs = std::span(arcs).subspan(
+            rowStarts[row], rowStarts[row + 1] - rowStarts[row]);
+        const auto node = rowArcs.front().first;
+        std::erase_if(adjacencyList[static_cast<size_t>(node)],
+                      [&](IndexType neighbor) {
+                          return std::ranges::binary_search(
+                              rowArcs, neighbor, {},
+                              &std::pair<IndexType, IndexType>::second);
+                      });
+
+        if (internal_isHub(node))
+        {
+            for (const auto &arc : rowArcs)
+                hubNeighbors[static_cast<size_t>(node)].erase(arc.second);
+            internal_updateHub(node);
+        }
+    });
+    return arcs;
 }
 
 template <typename T, typename IndexType>
 constexpr void ListGraph<T, IndexType>::clear()
 {
+    this->getNodeMap().clear();
     adjacencyList.clear();
+    hubNeighbors.clear();
+    this->getDegreeCounters().clear();
     edgeNumber = 0;
 }
 
@@ -309,7 +820,7 @@ constexpr bool ListGraph<T, IndexType>::isDirected() const
 template <typename T, typename IndexType>
 constexpr bool ListGraph<T, IndexType>::isWeighted() const
 {
-    return true;
+    return false;
 }
 
 template <typename T, typename IndexType>
@@ -345,4 +856,60 @@ void ListGraph<T, IndexType>::internal_assignParsedData(
     this->addEdge(parsedData.edges);
 }
 
+template <typename T, typename IndexType>
+void ListGraph<T, IndexType>::internal_assignBuiltAdjacency(
+    const internals::builtAdjacency<IndexType> &adjacency)
+{
+    const auto numberOfNodes = adjacency.getNumberOfNodes();
+    const auto directed = this->isDirected();
+    adjacencyList.assign(numberOfNodes, {});
+    auto &counters = this->getDegreeCounters();
+    counters.addNodes(numberOfNodes);
+
+    // Undirected rows list a self-loop twice
+    internals::parallelFor(
+        numberOfNodes,
+        [&](size_t, size_t node) {
+            const auto row = adjacency.getNeighbors(node);
+            auto &neighbors = adjacencyList[node];
+            neighbors.reserve(row.size() + 1);
+            for (const auto neighbor : row)
+            {
+                neighbors.emplace_back(neighbor);
+                if (!directed && static_cast<size_t>(neighbor) == node)
+                    neighbors.emplace_back(neighbor);
+            }
+            neighbors.shrink_to_fit();
+        },
+        64);
+
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto from = static_cast<IndexType>(node);
+        if (!directed)
+        {
+            for (size_t entry = 0; entry < adjacencyList[node].size(); entry++)
+                counters.addNeighbor(from);
+        }
+
+        for (const auto to : adjacency.getNeighbors(node))
+        {
+            if (!directed)
+            {
+                edgeNumber += static_cast<size_t>(from <= to);
+                continue;
+            }
+
+            // The reverse arc was counted first if its row comes first
+            edgeNumber++;
+            const auto reverseRow =
+                adjacency.getNeighbors(static_cast<size_t>(to));
+            const auto reverseArc =
+                to < from && std::ranges::binary_search(reverseRow, from);
+            counters.addArc(from, to, reverseArc);
+        }
+    }
+    setHubThreshold(hubThreshold);
+}
+
 } // namespace jGraph
@@ -2,13 +2,16 @@
 
 #include "DefaultTypes.hpp"
 #include "GraphAlgorithms.hpp"
+#include "GraphBuilder.hpp"
 #include "GraphMeasures.hpp"
 #include "GraphPrimitives.hpp"
 #include "GraphSerialization.hpp"
+#include "Parallel.hpp"
 
 #include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <numeric>
 #include <ranges>
 #include <span>
 #include <utility>
@@ -21,6 +24,7 @@ template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
 class MatrixGraph : public virtual GraphPrimitives<T, IndexType>,
                     public GraphAlgorithms<T, IndexType>,
                     public GraphSerialization<T, IndexType>,
+                    public GraphBuilder<T, IndexType>,
                     public GraphMeasures<T, IndexType>
 {
   public:
@@ -37,10 +41,12 @@ class MatrixGraph : public virtual GraphPrimitives<T, IndexType>,
     constexpr void addNode(T nodeName) override;
     constexpr void addNode(std::span<T> nodes) override;
     constexpr void removeNode(T nodeName) override;
+    constexpr void removeNode(std::span<T> nodes) override;
 
     constexpr void addEdge(std::pair<T, T> edge) override;
     constexpr void addEdge(std::span<std::pair<T, T>> edges) override;
     constexpr void removeEdge(std::pair<T, T> edge) override;
+    constexpr void removeEdge(std::span<std::pair<T, T>> edges) override;
     [[nodiscard]] constexpr bool hasEdge(std::pair<T, T> edge) const override;
 
     [[nodiscard]] constexpr size_t getNumberOfNodes() const override;
@@ -62,16 +68,26 @@ class MatrixGraph : public virtual GraphPrimitives<T, IndexType>,
     [[nodiscard]] constexpr size_t &getEdgeNumber();
     [[nodiscard]] constexpr size_t getEdgeNumber() const;
 
+    // Drops the node from the matrix and the degree counters, the last node
+    // taking its index, degrees of its neighbors being left to the caller
+    constexpr void internal_eraseNode(IndexType index);
+
   private:
     size_t edgeNumber = 0;
     std::vector<std::vector<IndexType>> edgeMatrix;
 
+    // Sets both cells of an undirected edge, a self-loop having a single one
+    constexpr void internal_setEdge(size_t first, size_t second,
+                                    IndexType value);
+
     constexpr std::vector<IndexType> internal_getNodes() const override;
     constexpr std::vector<IndexType> internal_getNeighbors(
         IndexType index) const override;
 
     void internal_assignParsedData(
         internals::parsedGraph<T> &parsedData) override;
+    void internal_assignBuiltAdjacency(
+        const internals::builtAdjacency<IndexType> &adjacency) override;
 };
 
 template <typename T, typename IndexType>
@@ -88,6 +104,7 @@ constexpr MatrixGraph<T, IndexType>::MatrixGraph(const R &rangeOfNodes)
                 row.emplace_back(false);
             }
             edgeMatrix.emplace_back(edgeMatrix.size() + 1, false);
+            this->getDegreeCounters().addNodes(1);
         }
     }
 }
@@ -102,6 +119,7 @@ constexpr void MatrixGraph<T, IndexType>::addNode(T nodeName)
             row.emplace_back(NOT_EDGE);
         }
         edgeMatrix.emplace_back(edgeMatrix.size() + 1, NOT_EDGE);
+        this->getDegreeCounters().addNodes(1);
     }
 }
 
@@ -122,6 +140,7 @@ constexpr void MatrixGraph<T, IndexType>::addNode(std::span<T> nodes)
         row.resize(newSize, NOT_EDGE);
     }
     edgeMatrix.resize(newSize, std::vector<IndexType>(newSize, NOT_EDGE));
+    this->getDegreeCounters().addNodes(nodesToAdd.size());
 }
 
 template <typename T, typename IndexType>
@@ -135,14 +154,108 @@ constexpr void MatrixGraph<T, IndexType>::removeNode(T nodeName)
 
         const auto indexToDelete =
             this->getNodeMap().convertNodeNameToIndex(nodeName);
-        edgeMatrix.erase(edgeMatrix.begin() + indexToDelete);
-        for (auto &vec : edgeMatrix)
+        const auto &row = edgeMatrix.at(static_cast<size_t>(indexToDelete));
+        for (size_t i = 0; i < row.size(); i++)
         {
-            vec.erase(vec.begin() + indexToDelete);
+            if (row[i] == EDGE && static_cast<IndexType>(i) != indexToDelete)
+                this->getDegreeCounters().removeNeighbor(
+                    static_cast<IndexType>(i));
         }
+        internal_eraseNode(indexToDelete);
+        this->getNodeMap().removeByName(nodeName);
     }
 }
 
+template <typename T, typename IndexType>
+constexpr void MatrixGraph<T, IndexType>::removeNode(std::span<T> nodes)
+{
+    const auto newIndexes =
+        this->getNodeMap().removeByName(std::span<const T>(nodes));
+    const auto remainingNodes = this->getNodeMap().getSize();
+    const auto size = edgeMatrix.size();
+    if (remainingNodes == size)
+        return;
+
+    // Arcs out of removed nodes on directed graphs, edges between removed
+    // nodes counted from their smaller end otherwise
+    constexpr auto removed =
+        internals::NameIndexMap<T, IndexType>::REMOVED_INDEX;
+    const auto directed = this->isDirected();
+    for (size_t node = 0; node < size; node++)
+    {
+        if (newIndexes[node] != removed)
+            continue;
+        for (size_t other = directed ? 0 : node; other < size; other++)
+        {
+            if (edgeMatrix[node][other] == EDGE &&
+                (directed || newIndexes[other] == removed))
+                edgeNumber--;
+        }
+    }
+
+    // Remaining rows lose the cells of removed nodes in place, in parallel,
+    // only reading the rows of removed nodes
+    std::vector<size_t> droppedArcs(internals::numberOfWorkers(size), 0);
+    internals::parallelFor(
+        size,
+        [&](size_t worker, size_t node) {
+            if (newIndexes[node] == removed)
+                return;
+            auto &row = edgeMatrix[node];
+            size_t degree = 0;
+            size_t inDegree = 0;
+            size_t outDegree = 0;
+            for (size_t other = 0; other < size; other++)
+            {
+                if (newIndexes[other] != removed)
+                {
+                    row[static_cast<size_t>(newIndexes[other])] = row[other];
+                    continue;
+                }
+                const auto out = row[other] == EDGE;
+                const auto in = edgeMatrix[other][node] == EDGE;
+                outDegree += out ? 1 : 0;
+                inDegree += in ? 1 : 0;
+                degree += out || in ? 1 : 0;
+            }
+            row.resize(remainingNodes);
+
+            this->getDegreeCounters().removeLinks(static_cast<IndexType>(node),
+                                                  degree, inDegree, outDegree);
+            droppedArcs[worker] += outDegree;
+        },
+        16);
+
+    for (size_t node = 0; node < size; node++)
+    {
+        const auto newIndex = static_cast<size_t>(newIndexes[node]);
+        if (newIndexes[node] != removed && newIndex != node)
+            edgeMatrix[newIndex] = std::move(edgeMatrix[node]);
+    }
+    edgeMatrix.resize(remainingNodes);
+    this->getDegreeCounters().removeNodes(newIndexes, remainingNodes);
+    edgeNumber -=
+        std::accumulate(droppedArcs.begin(), droppedArcs.end(), size_t{0});
+}
+
+template <typename T, typename IndexType>
+constexpr void MatrixGraph<T, IndexType>::internal_eraseNode(IndexType index)
+{
+    // The last row and column move to the index instead of shifting every
+    // cell above it
+    const auto position = static_cast<size_t>(index);
+    const auto last = edgeMatrix.size() - 1;
+    if (position != last)
+        edgeMatrix[position] = std::move(edgeMatrix[last]);
+    edgeMatrix.pop_back();
+    for (auto &row : edgeMatrix)
+    {
+        row[position] = row[last];
+        row.pop_back();
+    }
+    this->getDegreeCounters().removeNode(index);
+}
+
 template <typename T, typename IndexType>
 constexpr void MatrixGraph<T, IndexType>::addEdge(std::pair<T, T> edge)
 {
@@ -161,8 +274,7 @@ constexpr void MatrixGraph<T, IndexType>::addEdge(std::pair<T, T> edge)
     if (edgeMatrix.at(firstIndex).at(secondIndex) == NOT_EDGE)
     {
         edgeNumber++;
-        edgeMatrix[firstIndex][secondIndex] = EDGE;
-        edgeMatrix[secondIndex][firstIndex] = EDGE;
+        internal_setEdge(firstIndex, secondIndex, EDGE);
     }
 }
 
@@ -190,6 +302,7 @@ constexpr void MatrixGraph<T, IndexType>::addEdge(
     }
     edgeMatrix.resize(newMatrixSize,
                       std::vector<IndexType>(newMatrixSize, NOT_EDGE));
+    this->getDegreeCounters().addNodes(addedNodesCount);
 
     const auto edgesOfIndexes =
         this->getNodeMap().convertNodeNameToIndex(edges);
@@ -202,8 +315,7 @@ constexpr void MatrixGraph<T, IndexType>::addEdge(
         if (edgeMatrix.at(firstIndex).at(secondIndex) == NOT_EDGE)
         {
             edgeNumber++;
-            edgeMatrix[firstIndex][secondIndex] = EDGE;
-            edgeMatrix[secondIndex][firstIndex] = EDGE;
+            internal_setEdge(firstIndex, secondIndex, EDGE);
         }
     }
 }
@@ -217,10 +329,44 @@ constexpr void MatrixGraph<T, IndexType>::removeEdge(std::pair<T, T> edge)
         this->getNodeMap().convertNodeNameToIndex(edge.second));
 
     if (edgeMatrix.at(first).at(second) == EDGE)
+    {
         edgeNumber--;
+        internal_setEdge(first, second, NOT_EDGE);
+    }
+}
 
-    edgeMatrix[first][second] = NOT_EDGE;
-    edgeMatrix[second][first] = NOT_EDGE;
+template <typename T, typename IndexType>
+constexpr void MatrixGraph<T, IndexType>::removeEdge(
+    std::span<std::pair<T, T>> edges)
+{
+    // Clearing a cell is constant time already, there is no row to rewrite
+    for (const auto &edge : edges)
+    {
+        if (this->getNodeMap().contains(edge.first) &&
+            this->getNodeMap().contains(edge.second))
+            removeEdge(edge);
+    }
+}
+
+template <typename T, typename IndexType>
+constexpr void MatrixGraph<T, IndexType>::internal_setEdge(size_t first,
+                                                           size_t second,
+                                                           IndexType value)
+{
+    for (const auto &[row, column] : {std::pair(first, second),
+                                     std::pair(second, first)})
+    {
+        auto &cell = edgeMatrix[row][column];
+        if (cell == value)
+            continue;
+
+        cell = value;
+        if (value == EDGE)
+            this->getDegreeCounters().addNeighbor(static_cast<IndexType>(row));
+        else
+            this->getDegreeCounters().removeNeighbor(
+                static_cast<IndexType>(row));
+    }
 }
 
 template <typename T, typename IndexType>
@@ -321,7 +467,9 @@ constexpr size_t MatrixGraph<T, IndexType>::getNumberOfEdges() const
 template <typename T, typename IndexType>
 constexpr void MatrixGraph<T, IndexType>::clear()
 {
+    this->getNodeMap().clear();
     edgeMatrix.clear();
+    this->getDegreeCounters().clear();
     edgeNumber = 0;
 }
 
@@ -372,4 +520,45 @@ void MatrixGraph<T, IndexType>::internal_assignParsedData(
     this->addEdge(parsedData.edges);
 }
 
+template <typename T, typename IndexType>
+void MatrixGraph<T, IndexType>::internal_assignBuiltAdjacency(
+    const internals::builtAdjacency<IndexType> &adjacency)
+{
+    const auto numberOfNodes = adjacency.getNumberOfNodes();
+    const auto directed = this->isDirected();
+    edgeMatrix.assign(numberOfNodes,
+                      std::vector<IndexType>(numberOfNodes, NOT_EDGE));
+    auto &counters = this->getDegreeCounters();
+    counters.addNodes(numberOfNodes);
+
+    internals::parallelFor(
+        numberOfNodes,
+        [&](size_t, size_t node) {
+            for (const auto neighbor : adjacency.getNeighbors(node))
+                edgeMatrix[node][static_cast<size_t>(neighbor)] = EDGE;
+        },
+        64);
+
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto from = static_cast<IndexType>(node);
+        for (const auto to : adjacency.getNeighbors(node))
+        {
+            if (!directed)
+            {
+                counters.addNeighbor(from);
+                edgeNumber += static_cast<size_t>(from <= to);
+                continue;
+            }
+
+            // The reverse arc was counted first if its row comes first
+            edgeNumber++;
+            const auto reverseArc =
+                to < from &&
+                edgeMatrix[static_cast<size_t>(to)][node] == EDGE;
+            counters.addArc(from, to, reverseArc);
+        }
+    }
+}
+
 } // namespace jGraph
@@ -2,13 +2,18 @@
 
 #include "DefaultTypes.hpp"
 #include "GraphAlgorithms.hpp"
+#include "GraphBuilder.hpp"
 #include "GraphMeasures.hpp"
 #include "GraphPrimitives.hpp"
+#include "Parallel.hpp"
 #include "WeightedGraphPrimitives.hpp"
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
+#include <numeric>
 #include <optional>
+#include <ranges>
 #include <span>
 #include <tuple>
 #include <utility>
@@ -24,6 +29,7 @@ class WeightedListGraph
     : public GraphMeasures<T, IndexType>,
       public GraphAlgorithms<T, IndexType>,
       //   public GraphSerialization<T, IndexType>,
+      public GraphBuilder<T, IndexType>,
       public virtual GraphPrimitives<T, IndexType>,
       public virtual WeightedGraphPrimitives<T, IndexType, WeightType>
 {
@@ -37,6 +43,7 @@ class WeightedListGraph
     constexpr void addNode(T nodeName) override;
     constexpr void addNode(std::span<T> newNodes) override;
     constexpr void removeNode(T nodeName) override;
+    constexpr void removeNode(std::span<T> nodes) override;
 
     constexpr void addEdge(std::pair<T, T> edge) override;
     constexpr void addEdge(std::span<std::pair<T, T>> edges) override;
@@ -58,6 +65,7 @@ class WeightedListGraph
         std::span<std::tuple<T, T, WeightType>> edges) override;
 
     constexpr void removeEdge(std::pair<T, T> edge) override;
+    constexpr void removeEdge(std::span<std::pair<T, T>> edges) override;
     constexpr bool hasEdge(std::pair<T, T> edge) const override;
 
     [[nodiscard]] constexpr size_t getNumberOfNodes() const override;
@@ -73,9 +81,38 @@ class WeightedListGraph
     constexpr std::vector<std::pair<T, T>> getEdges() const override;
     constexpr std::vector<T> getNeighbors(T key) const override;
 
+    // Keeps every neighbor list sorted by neighbor, so that edge and weight
+    // lookups binary search them and edge batches are merged into them once
+    // per batch. Turning it on sorts the current lists.
+    constexpr void setSortedAdjacency(bool sorted);
+    [[nodiscard]] constexpr bool isAdjacencySorted() const;
+
+    // Replaces the graph by the one made of the given edges like
+    // buildFromEdges, repeated edges keeping the weight of the first one
+    void buildFromWeightedEdges(
+        std::span<const std::tuple<T, T, WeightType>> edges);
+
   private:
     size_t edgeNumber = 0;
     std::vector<std::vector<std::pair<IndexType, WeightType>>> adjacencyList;
+    bool sortedAdjacency = false;
+
+    // Position of the neighbor in the neighbor list of the node, the size of
+    // the list if absent
+    [[nodiscard]] constexpr size_t internal_findNeighbor(
+        IndexType node, IndexType neighbor) const;
+    constexpr void internal_insertNeighbor(IndexType node, IndexType neighbor,
+                                           WeightType weight);
+    // Renames every entry of the neighbor in the neighbors of the node to a
+    // smaller index, weights included
+    constexpr void internal_renameNeighbor(IndexType node, IndexType neighbor,
+                                           IndexType newNeighbor);
+
+    // Inserts a batch of edges, the first of repeated edges being kept
+    constexpr void internal_insertEdges(
+        std::vector<std::tuple<IndexType, IndexType, WeightType>> edges);
+    constexpr void internal_mergeEdges(
+        std::vector<std::tuple<IndexType, IndexType, WeightType>> edges);
 
     [[nodiscard]] constexpr bool internal_insertEdge(
         std::pair<IndexType, IndexType> edge);
@@ -85,6 +122,15 @@ class WeightedListGraph
     constexpr std::vector<IndexType> internal_getNodes() const override;
     constexpr std::vector<IndexType> internal_getNeighbors(
         IndexType index) const override;
+    constexpr std::vector<std::pair<IndexType, double>>
+    internal_getWeightedNeighbors(IndexType index) const override;
+
+    void internal_assignBuiltAdjacency(
+        const internals::builtAdjacency<IndexType> &adjacency) override;
+    // Edges get the weight of their source edge, or 1 without weights
+    void internal_assignWeightedRows(
+        const internals::builtAdjacency<IndexType> &adjacency,
+        std::span<const WeightType> edgeWeights);
 
     //  void internal_assignParsedData(
     //      internals::parsedGraph<T, WeightType> &parsedData) override;
@@ -93,7 +139,9 @@ class WeightedListGraph
 template <typename T, typename IndexType, typename WeightType>
 constexpr void WeightedListGraph<T, IndexType, WeightType>::clear()
 {
+    this->getNodeMap().clear();
     adjacencyList.clear();
+    this->getDegreeCounters().clear();
     edgeNumber = 0;
 }
 
@@ -113,7 +161,10 @@ template <typename T, typename IndexType, typename WeightType>
 constexpr void WeightedListGraph<T, IndexType, WeightType>::addNode(T nodeName)
 {
     if (this->getNodeMap().addByName(nodeName))
+    {
         adjacencyList.emplace_back();
+        this->getDegreeCounters().addNodes(1);
+    }
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -126,7 +177,10 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::addNode(
     for (const auto &node : newNodes)
     {
         if (this->getNodeMap().addByName(node))
+        {
             adjacencyList.emplace_back();
+            this->getDegreeCounters().addNodes(1);
+        }
     }
 
     const auto newSize = adjacencyList.size() + nodesToAdd.size();
@@ -140,28 +194,111 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::removeNode(
     if (!this->getNodeMap().contains(nodeName))
         return;
 
-    const auto associatedEdgesNumber = this->getNeighbors(nodeName).size();
-    edgeNumber -= associatedEdgesNumber;
-
     const auto index = this->getNodeMap().convertNodeNameToIndex(nodeName);
-    adjacencyList.erase(adjacencyList.begin() + index);
+    const auto position = static_cast<size_t>(index);
+    const auto last = adjacencyList.size() - 1;
+
+    // Only the neighbors of the node and of the last node are touched, the
+    // last node taking the index of the removed one. A self-loop is listed
+    // twice.
+    bool selfLoop = false;
+    for (const auto &[neighbor, weight] : adjacencyList[position])
+    {
+        if (neighbor == index)
+        {
+            selfLoop = true;
+            continue;
+        }
+        auto &neighbors = adjacencyList[static_cast<size_t>(neighbor)];
+        const auto found = internal_findNeighbor(neighbor, index);
+        neighbors.erase(neighbors.begin() +
+                        static_cast<std::ptrdiff_t>(found));
+        this->getDegreeCounters().removeNeighbor(neighbor);
+        edgeNumber--;
+    }
+    if (selfLoop)
+        edgeNumber--;
 
-    for (auto &node : adjacencyList)
+    if (position != last)
     {
-        node.erase(std::ranges::remove_if(
-                       node,
-                       [index](std::pair<IndexType, WeightType> &edge) {
-                           return edge.first == index;
-                       })
-                       .begin(),
-                   node.end());
+        for (const auto &[neighbor, weight] : adjacencyList[last])
+        {
+            if (static_cast<size_t>(neighbor) != last)
+            {
+                internal_renameNeighbor(neighbor, static_cast<IndexType>(last),
+                                        index);
+            }
+        }
+        adjacencyList[position] = std::move(adjacencyList[last]);
+        internal_renameNeighbor(index, static_cast<IndexType>(last), index);
+    }
+    adjacencyList.pop_back();
+    this->getDegreeCounters().removeNode(index);
+    this->getNodeMap().removeByName(nodeName);
+}
 
-        for (auto &[edge, _] : node)
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<T, IndexType, WeightType>::removeNode(
+    std::span<T> nodes)
+{
+    const auto newIndexes =
+        this->getNodeMap().removeByName(std::span<const T>(nodes));
+    const auto remainingNodes = this->getNodeMap().getSize();
+    if (remainingNodes == adjacencyList.size())
+        return;
+
+    // Edges between removed nodes are counted from their smaller end, a
+    // self-loop being listed twice
+    constexpr auto removed =
+        internals::NameIndexMap<T, IndexType>::REMOVED_INDEX;
+    size_t selfLoopEntries = 0;
+    for (size_t node = 0; node < adjacencyList.size(); node++)
+    {
+        if (newIndexes[node] != removed)
+            continue;
+        for (const auto &[neighbor, weight] : adjacencyList[node])
         {
-            if (edge > index)
-                edge--;
+            const auto other = static_cast<size_t>(neighbor);
+            if (other == node)
+                selfLoopEntries++;
+            else if (other > node && newIndexes[other] == removed)
+                edgeNumber--;
         }
     }
+    edgeNumber -= selfLoopEntries / 2;
+
+    // Every remaining list is rewritten once, in parallel, new indexes
+    // keeping the order of the old ones
+    std::vector<size_t> droppedEdges(
+        internals::numberOfWorkers(adjacencyList.size()), 0);
+    internals::parallelFor(
+        adjacencyList.size(),
+        [&](size_t worker, size_t node) {
+            if (newIndexes[node] == removed)
+                return;
+            auto &neighbors = adjacencyList[node];
+            const auto dropped = std::erase_if(neighbors, [&](const auto &arc) {
+                return newIndexes[static_cast<size_t>(arc.first)] == removed;
+            });
+            for (auto &[neighbor, weight] : neighbors)
+                neighbor = newIndexes[static_cast<size_t>(neighbor)];
+
+            this->getDegreeCounters().removeLinks(static_cast<IndexType>(node),
+                                                  dropped, dropped, dropped);
+            droppedEdges[worker] += dropped;
+        },
+        64);
+
+    for (size_t node = 0; node < adjacencyList.size(); node++)
+    {
+        const auto newIndex = static_cast<size_t>(newIndexes[node]);
+        if (newIndexes[node] != removed && newIndex != node)
+            adjacencyList[newIndex] = std::move(adjacencyList[node]);
+    }
+    adjacencyList.resize(remainingNodes);
+    this->getDegreeCounters().removeNodes(newIndexes, remainingNodes);
+    edgeNumber -=
+        std::accumulate(droppedEdges.begin(), droppedEdges.end(), size_t{0});
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -187,20 +324,86 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::removeEdge(
     const auto second = static_cast<size_t>(indexEdge.second);
 
     auto &vec = adjacencyList.at(first);
-    vec.erase(std::ranges::remove_if(vec, [&](const auto &pair) {
-                  return pair.first == second;
-              }).begin());
+    const auto removedEntries = std::erase_if(
+        vec, [&](const auto &pair) { return pair.first == indexEdge.second; });
+    for (size_t i = 0; i < removedEntries; i++)
+        this->getDegreeCounters().removeNeighbor(indexEdge.first);
+
+    // A self-loop leaves with both of its entries at once
+    if (first == second)
+    {
+        if (removedEntries > 0)
+            edgeNumber--;
+        return;
+    }
 
     auto &vec2 = adjacencyList.at(second);
     if (auto it = std::ranges::find_if(
-            vec2, [&](const auto &pair) { return pair.first == first; });
+            vec2,
+            [&](const auto &pair) { return pair.first == indexEdge.first; });
         it != vec2.end())
     {
         vec2.erase(it);
+        this->getDegreeCounters().removeNeighbor(indexEdge.second);
         edgeNumber--;
     }
 }
 
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<T, IndexType, WeightType>::removeEdge(
+    std::span<std::pair<T, T>> edges)
+{
+    // Both arcs of every edge in the graph, sorted by row
+    std::vector<std::pair<IndexType, IndexType>> arcs;
+    arcs.reserve(2 * edges.size());
+    for (const auto &edge : edges)
+    {
+        if (!this->getNodeMap().contains(edge.first) ||
+            !this->getNodeMap().contains(edge.second))
+            continue;
+        const auto [first, second] =
+            this->getNodeMap().convertNodeNameToIndex(edge);
+        arcs.emplace_back(first, second);
+        if (first != second)
+            arcs.emplace_back(second, first);
+    }
+    internals::parallelSort(arcs.begin(), arcs.end());
+    arcs.erase(std::unique(arcs.begin(), arcs.end()), arcs.end());
+    std::erase_if(arcs, [this](const auto &arc) {
+        return internal_findNeighbor(arc.first, arc.second) ==
+               adjacencyList[static_cast<size_t>(arc.first)].size();
+    });
+
+    std::vector<size_t> rowStarts;
+    for (size_t arc = 0; arc < arcs.size(); arc++)
+    {
+        if (arc == 0 || arcs[arc].first != arcs[arc - 1].first)
+            rowStarts.emplace_back(arc);
+    }
+    rowStarts.emplace_back(arcs.size());
+
+    internals::parallelFor(rowStarts.size() - 1, [&](size_t, size_t row) {
+        const auto rowArcs = std::span(arcs).subspan(
+            rowStarts[row], rowStarts[row + 1] - rowStarts[row]);
+        std::erase_if(adjacencyList[static_cast<size_t>(rowArcs[0].first)],
+                      [&](const auto &arc) {
+                          return std::ranges::binary_search(
+                              rowArcs, arc.first, {},
+                              &std::pair<IndexType, IndexType>::second);
+                      });
+    });
+
+    // Every edge removed both of its arcs, a self-loop its two entries
+    for (const auto &[from, to] : arcs)
+    {
+        this->getDegreeCounters().removeNeighbor(from);
+        if (from == to)
+            this->getDegreeCounters().removeNeighbor(from);
+        if (from <= to)
+            edgeNumber--;
+    }
+}
+
 template <typename T, typename IndexType, typename WeightType>
 constexpr void WeightedListGraph<T, IndexType, WeightType>::addWeightedEdge(
     std::pair<T, T> edge, WeightType weight)
@@ -234,13 +437,16 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::addWeightedEdge(
     }
     this->getNodeMap().shrinkToFit();
     adjacencyList.resize(adjacencyList.size() + addedNodesCount);
+    this->getDegreeCounters().addNodes(addedNodesCount);
 
-    for (const auto &edge : edges)
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> indexEdges;
+    indexEdges.reserve(edges.size());
+    for (const auto &[first, second] :
+         this->getNodeMap().convertNodeNameToIndex(edges))
     {
-        const auto indexEdge = this->getNodeMap().convertNodeNameToIndex(edge);
-        if (internal_insertEdge(indexEdge, weight))
-            edgeNumber++;
+        indexEdges.emplace_back(first, second, weight);
     }
+    internal_insertEdges(std::move(indexEdges));
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -261,14 +467,17 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::addWeightedEdge(
     }
     this->getNodeMap().shrinkToFit();
     adjacencyList.resize(adjacencyList.size() + addedNodesCount);
+    this->getDegreeCounters().addNodes(addedNodesCount);
 
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> indexEdges;
+    indexEdges.reserve(edges.size());
     for (size_t i = 0; i < edges.size(); i++)
     {
-        const auto indexEdge =
+        const auto [first, second] =
             this->getNodeMap().convertNodeNameToIndex(edges[i]);
-        if (internal_insertEdge(indexEdge, weights[i]))
-            edgeNumber++;
+        indexEdges.emplace_back(first, second, weights[i]);
     }
+    internal_insertEdges(std::move(indexEdges));
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -291,6 +500,8 @@ template <typename T, typename IndexType, typename WeightType>
 constexpr void WeightedListGraph<T, IndexType, WeightType>::addWeightedEdge(
     std::span<std::tuple<T, T, WeightType>> edges)
 {
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> indexEdges;
+    indexEdges.reserve(edges.size());
     for (const auto &edge : edges)
     {
         if (!this->getNodeMap().contains(std::get<0>(edge)))
@@ -298,12 +509,11 @@ constexpr void WeightedListGraph<T, IndexType, WeightType>::addWeightedEdge(
         if (!this->getNodeMap().contains(std::get<1>(edge)))
             addNode(std::get<1>(edge));
 
-        const auto indexEdge = this->getNodeMap().convertNodeNameToIndex(
+        const auto [first, second] = this->getNodeMap().convertNodeNameToIndex(
             std::pair(std::get<0>(edge), std::get<1>(edge)));
-
-        if (internal_insertEdge(indexEdge, std::get<2>(edge)))
-            edgeNumber++;
+        indexEdges.emplace_back(first, second, std::get<2>(edge));
     }
+    internal_insertEdges(std::move(indexEdges));
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -364,26 +574,16 @@ template <typename T, typename IndexType, typename WeightType>
 constexpr void WeightedListGraph<T, IndexType, WeightType>::setWeight(
     std::pair<T, T> edge, WeightType weight)
 {
-    const auto indexEdge = this->getNodeMap().convertNodeNameToIndex(edge);
+    const auto [first, second] =
+        this->getNodeMap().convertNodeNameToIndex(edge);
 
-    const auto foundNode = std::ranges::find_if(
-        adjacencyList.at(static_cast<size_t>(indexEdge.first)),
-        [indexEdge](const auto &pair) {
-            return pair.first == indexEdge.second;
-        });
-    if (foundNode != adjacencyList.at(static_cast<size_t>(edge.first)).end())
-    {
-        foundNode->second = weight;
-    }
-    const auto foundsecondNode = std::ranges::find_if(
-        adjacencyList.at(static_cast<size_t>(indexEdge.second)),
-        [indexEdge](const auto &pair) {
-            return pair.first == indexEdge.first;
-        });
-    if (foundsecondNode !=
-        adjacencyList.at(static_cast<size_t>(edge.second)).end())
+    for (const auto &[node, neighbor] :
+         {std::pair(first, second), std::pair(second, first)})
     {
-        foundsecondNode->second = weight;
+        const auto position = internal_findNeighbor(node, neighbor);
+        auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+        if (position != neighbors.size())
+            neighbors[position].second = weight;
     }
 }
 
@@ -391,17 +591,13 @@ template <typename T, typename IndexType, typename WeightType>
 constexpr std::optional<WeightType> WeightedListGraph<
     T, IndexType, WeightType>::getWeight(std::pair<T, T> edge) const
 {
-    const auto firstNode =
-        this->getNodeMap().convertNodeNameToIndex(edge.first);
-    const auto secondNode =
-        this->getNodeMap().convertNodeNameToIndex(edge.second);
-
-    const auto foundNode = std::ranges::find_if(
-        adjacencyList.at(static_cast<size_t>(firstNode)),
-        [secondNode](const auto &pair) { return pair.first == secondNode; });
+    const auto [first, second] =
+        this->getNodeMap().convertNodeNameToIndex(edge);
 
-    if (foundNode != adjacencyList.at(static_cast<size_t>(firstNode)).end())
-        return foundNode->second;
+    const auto position = internal_findNeighbor(first, second);
+    const auto &neighbors = adjacencyList.at(static_cast<size_t>(first));
+    if (position != neighbors.size())
+        return neighbors[position].second;
     return std::nullopt;
 }
 
@@ -412,26 +608,9 @@ constexpr std::vector<std::optional<WeightType>> WeightedListGraph<
     std::vector<std::optional<WeightType>> result;
     result.reserve(edges.size());
 
-    for (const auto &[first, second] : edges)
+    for (const auto &edge : edges)
     {
-        const auto firstNode = this->getNodeMap().convertNodeNameToIndex(first);
-        const auto secondNode =
-            this->getNodeMap().convertNodeNameToIndex(second);
-
-        const auto foundNode = std::ranges::find_if(
-            adjacencyList.at(static_cast<size_t>(firstNode)),
-            [secondNode](const auto &pair) {
-                return pair.first == secondNode;
-            });
-
-        if (foundNode != adjacencyList.at(static_cast<size_t>(firstNode)).end())
-        {
-            result.emplace_back(foundNode->second);
-        }
-        else
-        {
-            result.emplace_back(std::nullopt);
-        }
+        result.emplace_back(getWeight(edge));
     }
     return result;
 }
@@ -459,18 +638,126 @@ constexpr std::vector<IndexType> WeightedListGraph<
     return result;
 }
 
+template <typename T, typename IndexType, typename WeightType>
+constexpr std::vector<std::pair<IndexType, double>> WeightedListGraph<
+    T, IndexType, WeightType>::internal_getWeightedNeighbors(IndexType index)
+    const
+{
+    std::vector<std::pair<IndexType, double>> result;
+    const auto &adjaList = adjacencyList.at(static_cast<size_t>(index));
+
+    result.reserve(adjaList.size());
+    for (const auto &[neighbor, weight] : adjaList)
+    {
+        result.emplace_back(neighbor, static_cast<double>(weight));
+    }
+    return result;
+}
+
 template <typename T, typename IndexType, typename WeightType>
 constexpr bool WeightedListGraph<T, IndexType, WeightType>::hasEdge(
     std::pair<T, T> edge) const
 {
     const auto [firstIndex, secondIndex] =
         this->getNodeMap().convertNodeNameToIndex(edge);
-    const auto castedFirstIndex = static_cast<size_t>(firstIndex);
 
-    return (std::ranges::find_if(
-                adjacencyList.at(castedFirstIndex), [&](const auto &pair) {
-                    return pair.first == secondIndex;
-                }) == adjacencyList.at(castedFirstIndex).end());
+    return internal_findNeighbor(firstIndex, secondIndex) !=
+           adjacencyList.at(static_cast<size_t>(firstIndex)).size();
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<T, IndexType, WeightType>::setSortedAdjacency(
+    bool sorted)
+{
+    if (sorted && !sortedAdjacency)
+    {
+        internals::parallelFor(
+            adjacencyList.size(),
+            [&](size_t, size_t node) {
+                std::ranges::stable_sort(
+                    adjacencyList[node], {},
+                    &std::pair<IndexType, WeightType>::first);
+            },
+            64);
+    }
+    sortedAdjacency = sorted;
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr bool WeightedListGraph<T, IndexType, WeightType>::isAdjacencySorted()
+    const
+{
+    return sortedAdjacency;
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr size_t WeightedListGraph<
+    T, IndexType, WeightType>::internal_findNeighbor(IndexType node,
+                                                     IndexType neighbor) const
+{
+    const auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    const auto projection = &std::pair<IndexType, WeightType>::first;
+    if (sortedAdjacency)
+    {
+        const auto found =
+            std::ranges::lower_bound(neighbors, neighbor, {}, projection);
+        if (found != neighbors.end() && found->first == neighbor)
+            return static_cast<size_t>(found - neighbors.begin());
+        return neighbors.size();
+    }
+    return static_cast<size_t>(
+        std::ranges::find(neighbors, neighbor, projection) - neighbors.begin());
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<
+    T, IndexType, WeightType>::internal_insertNeighbor(IndexType node,
+                                                       IndexType neighbor,
+                                                       WeightType weight)
+{
+    auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    if (sortedAdjacency)
+    {
+        neighbors.emplace(
+            std::ranges::upper_bound(neighbors, neighbor, {},
+                                     &std::pair<IndexType, WeightType>::first),
+            neighbor, weight);
+    }
+    else
+    {
+        neighbors.emplace_back(neighbor, weight);
+    }
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<
+    T, IndexType, WeightType>::internal_renameNeighbor(IndexType node,
+                                                       IndexType neighbor,
+                                                       IndexType newNeighbor)
+{
+    assert(newNeighbor < neighbor);
+    auto &neighbors = adjacencyList.at(static_cast<size_t>(node));
+    const auto projection = &std::pair<IndexType, WeightType>::first;
+    if (!sortedAdjacency)
+    {
+        for (auto &[entry, weight] : neighbors)
+        {
+            if (entry == neighbor)
+                entry = newNeighbor;
+        }
+        return;
+    }
+
+    // The entries move down to where the new index sorts
+    const auto range =
+        std::ranges::equal_range(neighbors, neighbor, {}, projection);
+    const auto target =
+        std::ranges::upper_bound(neighbors.begin(), range.begin(),
+                                 newNeighbor, {}, projection);
+    std::rotate(target, range.begin(), range.end());
+    for (auto &[entry, weight] : std::ranges::subrange(
+             target, target + static_cast<std::ptrdiff_t>(range.size())))
+        entry = newNeighbor;
 }
 
 template <typename T, typename IndexType, typename WeightType>
@@ -484,19 +771,169 @@ template <typename T, typename IndexType, typename WeightType>
 constexpr bool WeightedListGraph<T, IndexType, WeightType>::internal_insertEdge(
     std::pair<IndexType, IndexType> edge, WeightType weight)
 {
-    if (std::ranges::find_if(
-            adjacencyList.at(static_cast<size_t>(edge.first)),
-            [&](const auto &pair) { return pair.first == edge.second; }) ==
-        adjacencyList.at(static_cast<size_t>(edge.first)).end())
+    if (internal_findNeighbor(edge.first, edge.second) !=
+        adjacencyList.at(static_cast<size_t>(edge.first)).size())
+        return false;
+
+    internal_insertNeighbor(edge.first, edge.second, weight);
+    internal_insertNeighbor(edge.second, edge.first, weight);
+    this->getDegreeCounters().addNeighbor(edge.first);
+    this->getDegreeCounters().addNeighbor(edge.second);
+    return true;
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr void
+WeightedListGraph<T, IndexType, WeightType>::internal_insertEdges(
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> edges)
+{
+    if (sortedAdjacency)
     {
-        adjacencyList.at(static_cast<size_t>(edge.first))
-            .emplace_back(edge.second, weight);
-        adjacencyList.at(static_cast<size_t>(edge.second))
-            .emplace_back(edge.first, weight);
+        internal_mergeEdges(std::move(edges));
+        return;
+    }
 
-        return true;
+    for (const auto &[first, second, weight] : edges)
+    {
+        if (internal_insertEdge(std::pair(first, second), weight))
+            edgeNumber++;
+    }
+}
+
+template <typename T, typename IndexType, typename WeightType>
+constexpr void WeightedListGraph<T, IndexType, WeightType>::internal_mergeEdges(
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> edges)
+{
+    // Both arcs of every edge, sorted with the first of repeated arcs kept,
+    // without the arcs already in the graph
+    std::vector<std::tuple<IndexType, IndexType, WeightType>> arcs;
+    arcs.reserve(2 * edges.size());
+    for (const auto &[first, second, weight] : edges)
+    {
+        arcs.emplace_back(first, second, weight);
+        arcs.emplace_back(second, first, weight);
+    }
+    const auto arcEnds = [](const auto &arc) {
+        return std::pair(std::get<0>(arc), std::get<1>(arc));
+    };
+    std::ranges::stable_sort(arcs, {}, arcEnds);
+    const auto repeated = std::ranges::unique(arcs, {}, arcEnds);
+    arcs.erase(repeated.begin(), repeated.end());
+    std::erase_if(arcs, [this](const auto &arc) {
+        const auto &neighbors =
+            adjacencyList.at(static_cast<size_t>(std::get<0>(arc)));
+        return internal_findNeighbor(std::get<0>(arc), std::get<1>(arc)) !=
+               neighbors.size();
+    });
+
+    std::vector<size_t> rowStarts;
+    for (size_t arc = 0; arc < arcs.size(); arc++)
+    {
+        if (arc == 0 || std::get<0>(arcs[arc]) != std::get<0>(arcs[arc - 1]))
+            rowStarts.emplace_back(arc);
+    }
+    rowStarts.emplace_back(arcs.size());
+
+    internals::parallelFor(rowStarts.size() - 1, [&](size_t, size_t row) {
+        auto &neighbors = adjacencyList[static_cast<size_t>(
+            std::get<0>(arcs[rowStarts[row]]))];
+        const auto oldSize = static_cast<std::ptrdiff_t>(neighbors.size());
+        for (size_t arc = rowStarts[row]; arc < rowStarts[row + 1]; arc++)
+        {
+            neighbors.emplace_back(std::get<1>(arcs[arc]),
+                                   std::get<2>(arcs[arc]));
+        }
+        std::inplace_merge(neighbors.begin(), neighbors.begin() + oldSize,
+                           neighbors.end(),
+                           [](const auto &lhs, const auto &rhs) {
+                               return lhs.first < rhs.first;
+                           });
+    });
+
+    // Every new edge comes with both of its arcs, and a self-loop is listed
+    // twice in the neighbors of its node
+    for (const auto &[from, to, weight] : arcs)
+    {
+        if (to < from)
+            continue;
+        edgeNumber++;
+        this->getDegreeCounters().addNeighbor(from);
+        this->getDegreeCounters().addNeighbor(to);
+        if (from == to)
+            internal_insertNeighbor(from, to, weight);
+    }
+}
+
+template <typename T, typename IndexType, typename WeightType>
+void WeightedListGraph<T, IndexType, WeightType>::buildFromWeightedEdges(
+    std::span<const std::tuple<T, T, WeightType>> edges)
+{
+    std::vector<std::pair<T, T>> endpoints;
+    std::vector<WeightType> weights;
+    endpoints.reserve(edges.size());
+    weights.reserve(edges.size());
+    for (const auto &[first, second, weight] : edges)
+    {
+        endpoints.emplace_back(first, second);
+        weights.emplace_back(weight);
+    }
+
+    clear();
+    internal_assignWeightedRows(
+        this->internal_buildAdjacency(endpoints, true), weights);
+}
+
+template <typename T, typename IndexType, typename WeightType>
+void WeightedListGraph<T, IndexType, WeightType>::internal_assignBuiltAdjacency(
+    const internals::builtAdjacency<IndexType> &adjacency)
+{
+    internal_assignWeightedRows(adjacency, {});
+}
+
+template <typename T, typename IndexType, typename WeightType>
+void WeightedListGraph<T, IndexType, WeightType>::internal_assignWeightedRows(
+    const internals::builtAdjacency<IndexType> &adjacency,
+    std::span<const WeightType> edgeWeights)
+{
+    const auto numberOfNodes = adjacency.getNumberOfNodes();
+    adjacencyList.assign(numberOfNodes, {});
+    auto &counters = this->getDegreeCounters();
+    counters.addNodes(numberOfNodes);
+
+    // A self-loop is listed twice in the neighbors of its node
+    internals::parallelFor(
+        numberOfNodes,
+        [&](size_t, size_t node) {
+            auto &neighbors = adjacencyList[node];
+            neighbors.reserve(adjacency.offsets[node + 1] -
+                              adjacency.offsets[node] + 1);
+            for (auto arc = adjacency.offsets[node];
+                 arc < adjacency.offsets[node + 1]; arc++)
+            {
+                const auto neighbor = adjacency.neighbors[arc];
+                const auto weight =
+                    edgeWeights.empty()
+                        ? WeightType{1}
+                        : edgeWeights[adjacency.sourceEdges[arc]];
+                neighbors.emplace_back(neighbor, weight);
+                if (static_cast<size_t>(neighbor) == node)
+                    neighbors.emplace_back(neighbor, weight);
+            }
+            neighbors.shrink_to_fit();
+        },
+        64);
+
+    for (size_t node = 0; node < numberOfNodes; node++)
+    {
+        const auto from = static_cast<IndexType>(node);
+        for (const auto &[to, weight] : adjacencyList[node])
+        {
+            counters.addNeighbor(from);
+            edgeNumber += static_cast<size_t>(from < to);
+        }
+        edgeNumber += static_cast<size_t>(
+            std::ranges::binary_search(adjacency.getNeighbors(node), from));
     }
-    return false;
 }
 
 } // namespace jGraph
@@ -0,0 +1,352 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "HyperLogLog.hpp"
+#include "Parallel.hpp"
+#include "ShortestPathEngine.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+namespace internals
+{
+struct neighborhoodFunctionResult
+{
+    // neighborhood[t] is the number of pairs (u, v) with v at distance at
+    // most t from u
+    std::vector<double> neighborhood;
+    std::vector<double> reachableNodes;
+    std::vector<double> distanceSums;
+    std::vector<double> harmonicSums;
+    std::vector<size_t> eccentricities;
+};
+} // namespace internals
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphCentrality : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Exact Brandes betweenness. Weighted graphs are traversed with djikstra,
+    // other graphs with breadth first searches.
+    [[nodiscard]] constexpr std::vector<std::pair<T, double>>
+    betweennessCentrality() const;
+
+    // Brandes betweenness accumulated from numberOfPivots sources sampled
+    // uniformly with the given seed, then scaled by
+    // numberOfNodes / numberOfPivots.
+    [[nodiscard]] constexpr std::vector<std::pair<T, double>>
+    betweennessCentrality(size_t numberOfPivots, uint64_t seed) const;
+
+    // The following measures are estimated with HyperANF : every node keeps a
+    // HyperLogLog counter of the nodes within distance t, and one pass over
+    // the edges takes every counter from t to t + 1. Each counter uses
+    // 2^log2Registers registers, the relative error being about
+    // 1.04 / sqrt(2^log2Registers). Directed graphs follow outgoing edges.
+    static constexpr uint8_t DEFAULT_LOG2_REGISTERS = 6;
+
+    [[nodiscard]] constexpr std::vector<std::pair<T, double>>
+    approximateClosenessCentrality(
+        uint8_t log2Registers = DEFAULT_LOG2_REGISTERS,
+        uint64_t seed = 0) const;
+    [[nodiscard]] constexpr std::vector<std::pair<T, double>>
+    approximateHarmonicCentrality(
+        uint8_t log2Registers = DEFAULT_LOG2_REGISTERS,
+        uint64_t seed = 0) const;
+    [[nodiscard]] constexpr std::vector<std::pair<T, size_t>>
+    approximateEccentricity(uint8_t log2Registers = DEFAULT_LOG2_REGISTERS,
+                            uint64_t seed = 0) const;
+    [[nodiscard]] constexpr std::vector<double> approximateNeighborhoodFunction(
+        uint8_t log2Registers = DEFAULT_LOG2_REGISTERS,
+        uint64_t seed = 0) const;
+    [[nodiscard]] constexpr double approximateEffectiveDiameter(
+        double fraction = 0.9, uint8_t log2Registers = DEFAULT_LOG2_REGISTERS,
+        uint64_t seed = 0) const;
+
+  protected:
+    template <typename ValueType>
+    [[nodiscard]] constexpr std::vector<std::pair<T, ValueType>>
+    internal_nameScores(const std::vector<ValueType> &scores) const;
+
+  private:
+    [[nodiscard]] constexpr std::vector<double> internal_betweennessCentrality(
+        std::span<const IndexType> sources) const;
+
+    [[nodiscard]] constexpr internals::neighborhoodFunctionResult
+    internal_hyperAnf(uint8_t log2Registers, uint64_t seed) const;
+};
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, double>> GraphCentrality<
+    T, IndexType>::betweennessCentrality() const
+{
+    const auto sources = this->internal_getNodes();
+    return internal_nameScores(internal_betweennessCentrality(sources));
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, double>> GraphCentrality<
+    T, IndexType>::betweennessCentrality(size_t numberOfPivots,
+                                         uint64_t seed) const
+{
+    const auto nodes = this->internal_getNodes();
+    if (numberOfPivots >= nodes.size())
+        return internal_nameScores(internal_betweennessCentrality(nodes));
+
+    std::vector<IndexType> pivots;
+    pivots.reserve(numberOfPivots);
+    std::mt19937_64 generator(seed);
+    std::ranges::sample(nodes, std::back_inserter(pivots),
+                        static_cast<std::ptrdiff_t>(numberOfPivots),
+                        generator);
+
+    auto scores = internal_betweennessCentrality(pivots);
+    const auto scale = static_cast<double>(nodes.size()) /
+                       static_cast<double>(pivots.size());
+    for (auto &score : scores)
+    {
+        score *= scale;
+    }
+    return internal_nameScores(scores);
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<double> GraphCentrality<
+    T, IndexType>::internal_betweennessCentrality(std::span<const IndexType>
+                                                      sources) const
+{
+    const auto numNodes = this->getNumberOfNodes();
+    const auto graph =
+        this->internal_compressOutgoingNeighbors(this->isWeighted());
+
+    const auto workers = internals::numberOfWorkers(sources.size());
+    std::vector<internals::ShortestPathEngine<IndexType>> engines(
+        workers, internals::ShortestPathEngine<IndexType>(graph));
+    std::vector<std::vector<double>> dependencies(
+        workers, std::vector<double>(numNodes, 0));
+    std::vector<std::vector<double>> partialScores(
+        workers, std::vector<double>(numNodes, 0));
+
+    internals::parallelFor(sources.size(), [&](size_t worker, size_t task) {
+        auto &engine = engines[worker];
+        auto &dependency = dependencies[worker];
+        auto &scores = partialScores[worker];
+        const auto source = sources[task];
+
+        engine.run(source);
+        const auto settledNodes = engine.getSettledNodes();
+
+        // Nodes are settled by non decreasing distance, so walking them
+        // backward accumulates the dependency of every successor first
+        for (auto it = settledNodes.rbegin(); it != settledNodes.rend(); ++it)
+        {
+            const auto node = *it;
+            const auto nodeIndex = static_cast<size_t>(node);
+            const auto neighbors = graph.getNeighbors(node);
+            const auto weights = graph.getWeights(node);
+            const auto nodeDistance = engine.getDistance(node);
+            const auto nodePaths = engine.getNumberOfShortestPaths(node);
+
+            double accumulated = 0;
+            for (size_t i = 0; i < neighbors.size(); i++)
+            {
+                const auto weight = weights.empty() ? 1.0 : weights[i];
+                if (engine.getDistance(neighbors[i]) == nodeDistance + weight)
+                {
+                    const auto neighborIndex =
+                        static_cast<size_t>(neighbors[i]);
+                    accumulated +=
+                        nodePaths /
+                        engine.getNumberOfShortestPaths(neighbors[i]) *
+                        (1 + dependency[neighborIndex]);
+                }
+            }
+            dependency[nodeIndex] = accumulated;
+            if (node != source)
+                scores[nodeIndex] += accumulated;
+        }
+
+        for (const auto node : settledNodes)
+        {
+            dependency[static_cast<size_t>(node)] = 0;
+        }
+    });
+
+    std::vector<double> result(numNodes, 0);
+    for (const auto &scores : partialScores)
+    {
+        std::ranges::transform(result, scores, result.begin(), std::plus<>{});
+    }
+
+    // Every shortest path of an undirected graph was counted from both ends
+    if (!this->isDirected())
+    {
+        for (auto &score : result)
+        {
+            score /= 2;
+        }
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, double>> GraphCentrality<
+    T, IndexType>::approximateClosenessCentrality(uint8_t log2Registers,
+                                                  uint64_t seed) const
+{
+    const auto anf = internal_hyperAnf(log2Registers, seed);
+
+    std::vector<double> scores(anf.distanceSums.size(), 0);
+    for (size_t i = 0; i < scores.size(); i++)
+    {
+        if (anf.distanceSums[i] > 0)
+            scores[i] = (anf.reachableNodes[i] - 1) / anf.distanceSums[i];
+    }
+    return internal_nameScores(scores);
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, double>> GraphCentrality<
+    T, IndexType>::approximateHarmonicCentrality(uint8_t log2Registers,
+                                                 uint64_t seed) const
+{
+    return internal_nameScores(
+        internal_hyperAnf(log2Registers, seed).harmonicSums);
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, size_t>> GraphCentrality<
+    T, IndexType>::approximateEccentricity(uint8_t log2Registers,
+                                           uint64_t seed) const
+{
+    return internal_nameScores(
+        internal_hyperAnf(log2Registers, seed).eccentricities);
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<double> GraphCentrality<
+    T, IndexType>::approximateNeighborhoodFunction(uint8_t log2Registers,
+                                                   uint64_t seed) const
+{
+    return internal_hyperAnf(log2Registers, seed).neighborhood;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphCentrality<T, IndexType>::approximateEffectiveDiameter(
+    double fraction, uint8_t log2Registers, uint64_t seed) const
+{
+    const auto neighborhood =
+        internal_hyperAnf(log2Registers, seed).neighborhood;
+    if (neighborhood.empty())
+        return 0;
+
+    const auto target = fraction * neighborhood.back();
+    const auto reached = std::ranges::find_if(
+        neighborhood, [target](double pairs) { return pairs >= target; });
+    if (reached == neighborhood.begin())
+        return 0;
+
+    // Linear interpolation between the last distance below the target and
+    // the first one reaching it
+    const auto distance = std::distance(neighborhood.begin(), reached);
+    const auto below = *std::prev(reached);
+    return static_cast<double>(distance - 1) +
+           ((target - below) / (*reached - below));
+}
+
+template <typename T, typename IndexType>
+constexpr internals::neighborhoodFunctionResult GraphCentrality<
+    T, IndexType>::internal_hyperAnf(uint8_t log2Registers,
+                                     uint64_t seed) const
+{
+    const auto numNodes = this->getNumberOfNodes();
+    const auto graph = this->internal_compressOutgoingNeighbors(false);
+
+    internals::neighborhoodFunctionResult result;
+    result.reachableNodes.assign(numNodes, 1);
+    result.distanceSums.assign(numNodes, 0);
+    result.harmonicSums.assign(numNodes, 0);
+    result.eccentricities.assign(numNodes, 0);
+    if (numNodes == 0)
+        return result;
+    result.neighborhood.emplace_back(static_cast<double>(numNodes));
+
+    internals::HyperLogLogCounters current(numNodes, log2Registers);
+    for (size_t node = 0; node < numNodes; node++)
+    {
+        current.add(node, internals::mixHash(node, seed));
+    }
+    auto next = current;
+    std::vector<uint8_t> nodeChanged(numNodes, 0);
+
+    constexpr size_t nodesPerTask = 64;
+    for (size_t distance = 1;; distance++)
+    {
+        internals::parallelFor(
+            numNodes,
+            [&](size_t, size_t node) {
+                bool grew = false;
+                for (const auto neighbor :
+                     graph.getNeighbors(static_cast<IndexType>(node)))
+                {
+                    grew |= next.merge(node, current,
+                                       static_cast<size_t>(neighbor));
+                }
+                nodeChanged[node] = static_cast<uint8_t>(grew);
+                if (!grew)
+                    return;
+
+                const auto estimate = next.estimate(node);
+                const auto newNodes =
+                    std::max(0.0, estimate - result.reachableNodes[node]);
+                result.reachableNodes[node] += newNodes;
+                result.distanceSums[node] +=
+                    static_cast<double>(distance) * newNodes;
+                result.harmonicSums[node] +=
+                    newNodes / static_cast<double>(distance);
+                result.eccentricities[node] = distance;
+            },
+            nodesPerTask);
+
+        if (std::ranges::none_of(nodeChanged,
+                                 [](uint8_t changed) { return changed != 0; }))
+            break;
+
+        result.neighborhood.emplace_back(std::reduce(
+            result.reachableNodes.begin(), result.reachableNodes.end()));
+        current = next;
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+template <typename ValueType>
+constexpr std::vector<std::pair<T, ValueType>> GraphCentrality<
+    T, IndexType>::internal_nameScores(const std::vector<ValueType> &scores)
+    const
+{
+    std::vector<std::pair<T, ValueType>> result;
+    result.reserve(scores.size());
+
+    for (size_t i = 0; i < scores.size(); i++)
+    {
+        result.emplace_back(this->getNodeMap().convertIndexToNodeName(
+                                static_cast<IndexType>(i)),
+                            scores[i]);
+    }
+    return result;
+}
+
+} // namespace jGraph
@@ -1,40 +1,152 @@
 #pragma once
+#include "CompressedAdjacency.hpp"
 #include "DefaultTypes.hpp"
+#include "GraphCentrality.hpp"
 #include "GraphPrimitives.hpp"
+#include "GraphSimilarity.hpp"
+#include "Parallel.hpp"
+#include "ShortestPathEngine.hpp"
+
+#include <algorithm>
 #include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace jGraph
 {
 
+// Degrees are the ones of GraphMeasures::degree, directed graphs counting
+// every node linked to a node in either direction
+struct graphSummary
+{
+    size_t numberOfNodes = 0;
+    size_t numberOfEdges = 0;
+    // Number of nodes of every degree, up to the largest one
+    std::vector<size_t> degreeHistogram;
+    size_t minimumDegree = 0;
+    size_t maximumDegree = 0;
+    double meanDegree = 0;
+    double degreeVariance = 0;
+    // Pearson correlation between the degrees at both ends of the edges,
+    // NaN if there is no edge or if all of them join nodes of equal degrees
+    double degreeAssortativity = 0;
+    size_t selfLoops = 0;
+    size_t isolatedNodes = 0;
+};
+
 template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
-class GraphMeasures : public virtual GraphPrimitives<T, IndexType>
+class GraphMeasures : public GraphCentrality<T, IndexType>,
+                      public GraphSimilarity<T, IndexType>,
+                      public virtual GraphPrimitives<T, IndexType>
 {
   public:
+    // Number of neighbors, nodes linked in either direction on directed
+    // graphs. Degrees are maintained as the graph changes, so reading them
+    // costs a lookup of the node.
     [[nodiscard]] constexpr size_t degree(T node) const;
+    // Equal to degree on undirected graphs
+    [[nodiscard]] constexpr size_t inDegree(T node) const;
+    [[nodiscard]] constexpr size_t outDegree(T node) const;
+
+    // Degree of every node, in the order of getNodes(). Spans are valid
+    // until the graph is modified.
+    [[nodiscard]] constexpr std::span<const size_t> degrees() const;
+    [[nodiscard]] constexpr std::span<const size_t> inDegrees() const;
+    [[nodiscard]] constexpr std::span<const size_t> outDegrees() const;
+
     [[nodiscard]] constexpr float averageNeighborDegree() const;
     [[nodiscard]] constexpr float density() const;
+
+    // Degree distribution and counts of a graph, computed by a single
+    // parallel pass over the nodes with partial results for every worker.
+    // The pass reads a snapshot of the rows, which is also laid out in
+    // parallel and in linear time.
+    [[nodiscard]] constexpr graphSummary summaryStatistics() const;
+
+    // Exact diameter and radius of every connected component, as
+    // (component, diameter, radius). Eccentricities are bounded with the
+    // Takes-Kosters technique, which usually settles a component after a few
+    // tens of traversals instead of one per node. Edge directions are
+    // ignored and weighted graphs use their weights as edge lengths.
+    [[nodiscard]] constexpr std::vector<std::tuple<std::vector<T>, double,
+                                                   double>>
+    componentsDiameterAndRadius() const;
+
+    // Infinite if the graph is not connected
+    [[nodiscard]] constexpr double diameter() const;
+    [[nodiscard]] constexpr double radius() const;
+
+  private:
+    [[nodiscard]] constexpr std::vector<
+        std::tuple<std::vector<IndexType>, double, double>>
+    internal_componentsDiameterAndRadius() const;
+
+    [[nodiscard]] static constexpr std::pair<double, double>
+    internal_boundingEccentricities(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::span<const IndexType> component,
+        internals::ShortestPathEngine<IndexType> &engine,
+        std::vector<double> &lowerBounds, std::vector<double> &upperBounds);
 };
 
 template <typename T, typename IndexType>
 constexpr size_t GraphMeasures<T, IndexType>::degree(T node) const
 {
-    return this->getNeighbors(node).size();
+    return this->getDegreeCounters().getDegree(
+        this->getNodeMap().convertNodeNameToIndex(node));
+}
+
+template <typename T, typename IndexType>
+constexpr size_t GraphMeasures<T, IndexType>::inDegree(T node) const
+{
+    return this->getDegreeCounters().getInDegree(
+        this->getNodeMap().convertNodeNameToIndex(node));
+}
+
+template <typename T, typename IndexType>
+constexpr size_t GraphMeasures<T, IndexType>::outDegree(T node) const
+{
+    return this->getDegreeCounters().getOutDegree(
+        this->getNodeMap().convertNodeNameToIndex(node));
+}
+
+template <typename T, typename IndexType>
+constexpr std::span<const size_t> GraphMeasures<T, IndexType>::degrees() const
+{
+    return this->getDegreeCounters().getDegrees();
+}
+
+template <typename T, typename IndexType>
+constexpr std::span<const size_t> GraphMeasures<T, IndexType>::inDegrees()
+    const
+{
+    return this->getDegreeCounters().getInDegrees();
+}
+
+template <typename T, typename IndexType>
+constexpr std::span<const size_t> GraphMeasures<T, IndexType>::outDegrees()
+    const
+{
+    return this->getDegreeCounters().getOutDegrees();
 }
 
 template <typename T, typename IndexType>
 constexpr float GraphMeasures<T, IndexType>::averageNeighborDegree() const
 {
-    float result = 0;
-    const auto &nodes = this->getNodes();
+    const auto allDegrees = degrees();
+    if (allDegrees.empty())
+        return 0;
 
-    for (const auto &node : nodes)
+    size_t total = 0;
+    for (const auto nodeDegree : allDegrees)
     {
-        result += static_cast<float>(this->getNeighbors(node).size());
+        total += nodeDegree;
     }
-
-    result /= static_cast<float>(nodes.size());
-
-    return result;
+    return static_cast<float>(total) / static_cast<float>(allDegrees.size());
 }
 
 template <typename T, typename IndexType>
@@ -53,4 +165,284 @@ constexpr float GraphMeasures<T, IndexType>::density() const
     return density;
 }
 
+template <typename T, typename IndexType>
+constexpr graphSummary GraphMeasures<T, IndexType>::summaryStatistics() const
+{
+    const auto graph = this->internal_compressNeighbors();
+    const auto numNodes = graph.getNumberOfNodes();
+
+    struct partialSummary
+    {
+        std::vector<size_t> degreeHistogram;
+        size_t minimumDegree = std::numeric_limits<size_t>::max();
+        size_t maximumDegree = 0;
+        size_t degreeSum = 0;
+        size_t squaredDegreeSum = 0;
+        size_t selfLoops = 0;
+        // Sums over the arcs (u, v) of d(u), d(u)^2 and d(u) * d(v). Every
+        // edge is seen from both ends, so the sums over the degrees of the
+        // heads are the same as the ones over the tails.
+        double arcDegreeSum = 0;
+        double arcSquaredDegreeSum = 0;
+        double arcDegreeProductSum = 0;
+    };
+
+    std::vector<partialSummary> partials(internals::numberOfWorkers(numNodes));
+    internals::parallelFor(
+        numNodes,
+        [&](size_t worker, size_t task) {
+            auto &partial = partials[worker];
+            const auto node = static_cast<IndexType>(task);
+            const auto nodeDegree = graph.getDegree(node);
+
+            if (partial.degreeHistogram.size() <= nodeDegree)
+                partial.degreeHistogram.resize(nodeDegree + 1, 0);
+            partial.degreeHistogram[nodeDegree]++;
+            partial.minimumDegree = std::min(partial.minimumDegree, nodeDegree);
+            partial.maximumDegree = std::max(partial.maximumDegree, nodeDegree);
+            partial.degreeSum += nodeDegree;
+            partial.squaredDegreeSum += nodeDegree * nodeDegree;
+
+            const auto tailDegree = static_cast<double>(nodeDegree);
+            bool hasSelfLoop = false;
+            for (const auto neighbor : graph.getNeighbors(node))
+            {
+                hasSelfLoop = hasSelfLoop || neighbor == node;
+                const auto headDegree =
+                    static_cast<double>(graph.getDegree(neighbor));
+                partial.arcDegreeSum += tailDegree;
+                partial.arcSquaredDegreeSum += tailDegree * tailDegree;
+                partial.arcDegreeProductSum += tailDegree * headDegree;
+            }
+            partial.selfLoops += static_cast<size_t>(hasSelfLoop);
+        },
+        256);
+
+    graphSummary result;
+    result.numberOfNodes = numNodes;
+    result.numberOfEdges = this->getNumberOfEdges();
+    result.degreeAssortativity = std::numeric_limits<double>::quiet_NaN();
+    if (numNodes == 0)
+        return result;
+
+    partialSummary total;
+    for (const auto &partial : partials)
+    {
+        if (total.degreeHistogram.size() < partial.degreeHistogram.size())
+            total.degreeHistogram.resize(partial.degreeHistogram.size(), 0);
+        for (size_t i = 0; i < partial.degreeHistogram.size(); i++)
+        {
+            total.degreeHistogram[i] += partial.degreeHistogram[i];
+        }
+        total.minimumDegree =
+            std::min(total.minimumDegree, partial.minimumDegree);
+        total.maximumDegree =
+            std::max(total.maximumDegree, partial.maximumDegree);
+        total.degreeSum += partial.degreeSum;
+        total.squaredDegreeSum += partial.squaredDegreeSum;
+        total.selfLoops += partial.selfLoops;
+        total.arcDegreeSum += partial.arcDegreeSum;
+        total.arcSquaredDegreeSum += partial.arcSquaredDegreeSum;
+        total.arcDegreeProductSum += partial.arcDegreeProductSum;
+    }
+
+    const auto nodes = static_cast<double>(numNodes);
+    result.degreeHistogram = std::move(total.degreeHistogram);
+    result.minimumDegree = total.minimumDegree;
+    result.maximumDegree = total.maximumDegree;
+    result.meanDegree = static_cast<double>(total.degreeSum) / nodes;
+    result.degreeVariance = std::max(
+        0.0, (static_cast<double>(total.squaredDegreeSum) / nodes) -
+                 (result.meanDegree * result.meanDegree));
+    result.selfLoops = total.selfLoops;
+    result.isolatedNodes = result.degreeHistogram.front();
+
+    const auto arcs = static_cast<double>(graph.getNumberOfArcs());
+    if (arcs > 0)
+    {
+        const auto arcMean = total.arcDegreeSum / arcs;
+        const auto covariance =
+            (total.arcDegreeProductSum / arcs) - (arcMean * arcMean);
+        const auto variance =
+            (total.arcSquaredDegreeSum / arcs) - (arcMean * arcMean);
+        if (variance > 0)
+            result.degreeAssortativity = covariance / variance;
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::tuple<std::vector<T>, double, double>> GraphMeasures<
+    T, IndexType>::componentsDiameterAndRadius() const
+{
+    std::vector<std::tuple<std::vector<T>, double, double>> result;
+    auto components = internal_componentsDiameterAndRadius();
+    result.reserve(components.size());
+
+    for (const auto &[component, componentDiameter, componentRadius] :
+         components)
+    {
+        result.emplace_back(
+            this->getNodeMap().convertIndexToNodeName(component),
+            componentDiameter, componentRadius);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphMeasures<T, IndexType>::diameter() const
+{
+    const auto components = internal_componentsDiameterAndRadius();
+    if (components.empty())
+        return 0;
+    if (components.size() > 1)
+        return std::numeric_limits<double>::infinity();
+    return std::get<1>(components.front());
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphMeasures<T, IndexType>::radius() const
+{
+    const auto components = internal_componentsDiameterAndRadius();
+    if (components.empty())
+        return 0;
+    if (components.size() > 1)
+        return std::numeric_limits<double>::infinity();
+    return std::get<2>(components.front());
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::tuple<std::vector<IndexType>, double, double>>
+GraphMeasures<T, IndexType>::internal_componentsDiameterAndRadius() const
+{
+    const auto numNodes = this->getNumberOfNodes();
+    // Edge directions are ignored whether the graph is weighted or not
+    const auto graph = this->internal_compressUndirectedNeighbors();
+
+    std::vector<std::tuple<std::vector<IndexType>, double, double>> result;
+    internals::ShortestPathEngine<IndexType> componentEngine(graph);
+    std::vector<bool> visited(numNodes, false);
+    for (size_t node = 0; node < numNodes; node++)
+    {
+        if (visited[node])
+            continue;
+
+        componentEngine.breadthFirstSearch(static_cast<IndexType>(node));
+        const auto settledNodes = componentEngine.getSettledNodes();
+        for (const auto settledNode : settledNodes)
+        {
+            visited[static_cast<size_t>(settledNode)] = true;
+        }
+        result.emplace_back(
+            std::vector<IndexType>(settledNodes.begin(), settledNodes.end()),
+            0, 0);
+    }
+
+    // Components are disjoint, so workers share the bound arrays without
+    // ever writing to the same entry
+    std::vector<double> lowerBounds(numNodes, 0);
+    std::vector<double> upperBounds(numNodes, 0);
+    const auto workers = internals::numberOfWorkers(result.size());
+    std::vector<internals::ShortestPathEngine<IndexType>> engines(
+        workers, internals::ShortestPathEngine<IndexType>(graph));
+
+    internals::parallelFor(result.size(), [&](size_t worker, size_t task) {
+        auto &[component, componentDiameter, componentRadius] = result[task];
+        std::tie(componentDiameter, componentRadius) =
+            internal_boundingEccentricities(graph, component, engines[worker],
+                                            lowerBounds, upperBounds);
+    });
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::pair<double, double> GraphMeasures<T, IndexType>::
+    internal_boundingEccentricities(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        std::span<const IndexType> component,
+        internals::ShortestPathEngine<IndexType> &engine,
+        std::vector<double> &lowerBounds, std::vector<double> &upperBounds)
+{
+    if (component.size() == 1)
+        return {0, 0};
+
+    for (const auto node : component)
+    {
+        lowerBounds[static_cast<size_t>(node)] = 0;
+        upperBounds[static_cast<size_t>(node)] =
+            std::numeric_limits<double>::infinity();
+    }
+
+    bool pickLargestUpperBound = true;
+    while (true)
+    {
+        double diameterLower = 0;
+        double diameterUpper = 0;
+        double radiusLower = std::numeric_limits<double>::infinity();
+        double radiusUpper = std::numeric_limits<double>::infinity();
+        for (const auto node : component)
+        {
+            const auto index = static_cast<size_t>(node);
+            diameterLower = std::max(diameterLower, lowerBounds[index]);
+            diameterUpper = std::max(diameterUpper, upperBounds[index]);
+            radiusLower = std::min(radiusLower, lowerBounds[index]);
+            radiusUpper = std::min(radiusUpper, upperBounds[index]);
+        }
+
+        const bool diameterFound = diameterLower >= diameterUpper;
+        const bool radiusFound = radiusLower >= radiusUpper;
+        if (diameterFound && radiusFound)
+            return {diameterLower, radiusLower};
+
+        if (diameterFound)
+            pickLargestUpperBound = false;
+        else if (radiusFound)
+            pickLargestUpperBound = true;
+
+        // Alternate between the node that may have the largest eccentricity
+        // and the one that may have the smallest, preferring hubs on ties
+        auto isBetterCandidate = [&](IndexType lhs, IndexType rhs) {
+            const auto lhsIndex = static_cast<size_t>(lhs);
+            const auto rhsIndex = static_cast<size_t>(rhs);
+            const auto lhsBound = pickLargestUpperBound
+                                      ? upperBounds[lhsIndex]
+                                      : -lowerBounds[lhsIndex];
+            const auto rhsBound = pickLargestUpperBound
+                                      ? upperBounds[rhsIndex]
+                                      : -lowerBounds[rhsIndex];
+            if (lhsBound != rhsBound)
+                return lhsBound > rhsBound;
+            return graph.getDegree(lhs) > graph.getDegree(rhs);
+        };
+
+        std::optional<IndexType> candidate;
+        for (const auto node : component)
+        {
+            const auto index = static_cast<size_t>(node);
+            if (lowerBounds[index] >= upperBounds[index])
+                continue;
+            if (!candidate || isBetterCandidate(node, candidate.value()))
+                candidate = node;
+        }
+        pickLargestUpperBound = !pickLargestUpperBound;
+
+        const auto source = candidate.value();
+        engine.run(source);
+        const auto eccentricity =
+            engine.getDistance(engine.getSettledNodes().back());
+
+        for (const auto node : component)
+        {
+            const auto index = static_cast<size_t>(node);
+            const auto distance = engine.getDistance(node);
+            lowerBounds[index] = std::max(
+                {lowerBounds[index], distance, eccentricity - distance});
+            upperBounds[index] =
+                std::min(upperBounds[index], eccentricity + distance);
+        }
+        lowerBounds[static_cast<size_t>(source)] = eccentricity;
+        upperBounds[static_cast<size_t>(source)] = eccentricity;
+    }
+}
+
 } // namespace jGraph
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "CompressedAdjacency.hpp"
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "Parallel.hpp"
+#include "SortedIntersection.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+enum SimilarityMeasure : std::uint8_t
+{
+    // Number of common neighbors
+    COMMON_NEIGHBORS,
+    // Common neighbors over the union of both neighborhoods
+    JACCARD,
+    // Common neighbors over the geometric mean of both degrees
+    COSINE,
+    // Sum of 1 / log(degree) over the common neighbors
+    ADAMIC_ADAR,
+    // Sum of 1 / degree over the common neighbors
+    RESOURCE_ALLOCATION
+};
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphSimilarity : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Neighborhood similarity of every pair, scores[i] being the one of
+    // pairs[i]. Edge directions and repeated edges are ignored, and nodes
+    // are not their own neighbors. Pairs are scored in parallel, each by
+    // intersecting sorted neighborhoods.
+    constexpr void similarity(std::span<const std::pair<T, T>> pairs,
+                              std::span<double> scores,
+                              SimilarityMeasure measure = JACCARD) const;
+
+    [[nodiscard]] constexpr std::vector<double> similarity(
+        std::span<const std::pair<T, T>> pairs,
+        SimilarityMeasure measure = JACCARD) const;
+
+    // The k nodes most similar to the given one, linked to it or not, by
+    // decreasing similarity. Only nodes sharing a neighbor with it can
+    // score above 0, so they are found by walking two hops from it instead
+    // of scoring every other node.
+    [[nodiscard]] constexpr std::vector<std::pair<T, double>>
+    mostSimilarNodes(T node, size_t k,
+                     SimilarityMeasure measure = JACCARD) const;
+
+  private:
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_similarityAdjacency() const;
+
+    // Contribution of every node to the similarity of pairs of its
+    // neighbors, for the measures that weigh common neighbors
+    [[nodiscard]] static constexpr std::vector<double>
+    internal_commonNeighborWeights(
+        const internals::CompressedAdjacency<IndexType> &graph,
+        SimilarityMeasure measure);
+
+    // Similarity from the number or the weight of common neighbors
+    [[nodiscard]] static constexpr double internal_score(
+        SimilarityMeasure measure, double common, size_t firstDegree,
+        size_t secondDegree);
+};
+
+template <typename T, typename IndexType>
+constexpr void GraphSimilarity<T, IndexType>::similarity(
+    std::span<const std::pair<T, T>> pairs, std::span<double> scores,
+    SimilarityMeasure measure) const
+{
+    assert(scores.size() >= pairs.size());
+    const auto graph = internal_similarityAdjacency();
+    const auto weights = internal_commonNeighborWeights(graph, measure);
+
+    internals::parallelFor(
+        pairs.size(),
+        [&](size_t, size_t pair) {
+            const auto [first, second] =
+                this->getNodeMap().convertNodeNameToIndex(pairs[pair]);
+            const auto firstNeighbors = graph.getNeighbors(first);
+            const auto secondNeighbors = graph.getNeighbors(second);
+
+            double common = 0;
+            if (weights.empty())
+            {
+                common = static_cast<double>(internals::intersectionSize(
+                    firstNeighbors, secondNeighbors));
+            }
+            else
+            {
+                common = internals::weightedIntersection(
+                    firstNeighbors, secondNeighbors,
+                    std::span<const double>(weights));
+            }
+            scores[pair] = internal_score(measure, common,
+                                          firstNeighbors.size(),
+                                          secondNeighbors.size());
+        },
+        256);
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<double> GraphSimilarity<T, IndexType>::similarity(
+    std::span<const std::pair<T, T>> pairs, SimilarityMeasure measure) const
+{
+    std::vector<double> result(pairs.size());
+    similarity(pairs, result, measure);
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<std::pair<T, double>> GraphSimilarity<
+    T, IndexType>::mostSimilarNodes(T node, size_t k,
+                                    SimilarityMeasure measure) const
+{
+    const auto graph = internal_similarityAdjacency();
+    const auto weights = internal_commonNeighborWeights(graph, measure);
+    const auto source = this->getNodeMap().convertNodeNameToIndex(node);
+
+    // Number or weight of the common neighbors of the source and every node
+    // two hops away from it
+    std::vector<double> common(graph.getNumberOfNodes(), 0);
+    std::vector<IndexType> candidates;
+    for (const auto neighbor : graph.getNeighbors(source))
+    {
+        const auto contribution =
+            weights.empty() ? 1 : weights[static_cast<size_t>(neighbor)];
+        for (const auto candidate : graph.getNeighbors(neighbor))
+        {
+            if (candidate == source)
+                continue;
+            auto &candidateCommon = common[static_cast<size_t>(candidate)];
+            if (candidateCommon == 0)
+                candidates.emplace_back(candidate);
+            candidateCommon += contribution;
+        }
+    }
+
+    std::vector<std::pair<double, IndexType>> scores;
+    scores.reserve(candidates.size());
+    const auto sourceDegree = graph.getDegree(source);
+    for (const auto candidate : candidates)
+    {
+        scores.emplace_back(
+            internal_score(measure, common[static_cast<size_t>(candidate)],
+                           sourceDegree, graph.getDegree(candidate)),
+            candidate);
+    }
+
+    const auto best = std::min(k, scores.size());
+    std::ranges::partial_sort(
+        scores, scores.begin() + static_cast<std::ptrdiff_t>(best),
+        [](const auto &first, const auto &second) {
+            return first.first > second.first ||
+                   (first.first == second.first &&
+                    first.second < second.second);
+        });
+
+    std::vector<std::pair<T, double>> result;
+    result.reserve(best);
+    for (size_t i = 0; i < best; i++)
+    {
+        result.emplace_back(
+            this->getNodeMap().convertIndexToNodeName(scores[i].second),
+            scores[i].first);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphSimilarity<
+    T, IndexType>::internal_similarityAdjacency() const
+{
+    auto graph = this->internal_compressNeighbors();
+    graph.sortAndDeduplicateRows(false);
+    return graph;
+}
+
+template <typename T, typename IndexType>
+constexpr std::vector<double> GraphSimilarity<
+    T, IndexType>::internal_commonNeighborWeights(
+    const internals::CompressedAdjacency<IndexType> &graph,
+    SimilarityMeasure measure)
+{
+    if (measure != ADAMIC_ADAR && measure != RESOURCE_ALLOCATION)
+        return {};
+
+    // A common neighbor of two distinct nodes has a degree of at least 2
+    std::vector<double> weights(graph.getNumberOfNodes(), 0);
+    for (size_t node = 0; node < weights.size(); node++)
+    {
+        const auto degree =
+            static_cast<double>(graph.getDegree(static_cast<IndexType>(node)));
+        if (degree < 2)
+            continue;
+        weights[node] = measure == ADAMIC_ADAR ? 1 / std::log(degree)
+                                               : 1 / degree;
+    }
+    return weights;
+}
+
+template <typename T, typename IndexType>
+constexpr double GraphSimilarity<T, IndexType>::internal_score(
+    SimilarityMeasure measure, double common, size_t firstDegree,
+    size_t secondDegree)
+{
+    const auto first = static_cast<double>(firstDegree);
+    const auto second = static_cast<double>(secondDegree);
+    if (measure == JACCARD)
+    {
+        const auto united = first + second - common;
+        return united > 0 ? common / united : 0;
+    }
+    if (measure == COSINE)
+    {
+        const auto product = first * second;
+        return product > 0 ? common / std::sqrt(product) : 0;
+    }
+    return common;
+}
+
+}; // namespace jGraph
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "DefaultTypes.hpp"
+#include "GraphPrimitives.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace jGraph
+{
+
+namespace internals
+{
+
+// Rows of a graph built from an edge array, every row sorted and without
+// repetitions. Undirected graphs have both arcs of every edge, a self-loop
+// having a single one.
+template <typename IndexType>
+struct builtAdjacency
+{
+    // The row of a node is [offsets[node], offsets[node + 1]) in neighbors
+    std::vector<size_t> offsets;
+    std::vector<IndexType> neighbors;
+    // Position in the edge array of the edge behind every arc, the first one
+    // of repeated edges, if asked for
+    std::vector<size_t> sourceEdges;
+
+    [[nodiscard]] constexpr size_t getNumberOfNodes() const
+    {
+        return offsets.size() - 1;
+    }
+
+    [[nodiscard]] constexpr std::span<const IndexType> getNeighbors(
+        size_t node) const
+    {
+        return std::span<const IndexType>(neighbors).subspan(
+            offsets[node], offsets[node + 1] - offsets[node]);
+    }
+};
+
+} // namespace internals
+
+template <typename T, typename IndexType = internals::underlyingGraphIndex_t>
+class GraphBuilder : public virtual GraphPrimitives<T, IndexType>
+{
+  public:
+    // Replaces the graph by the one made of the given edges, repeated edges
+    // being added once and nodes numbered by increasing name. Endpoints are
+    // numbered by sorting them once instead of looking every one of them up,
+    // and arcs are radix sorted into their final rows instead of being
+    // inserted one by one, sorts running in parallel. Arcs are packed in 64
+    // bits, so 2^32 nodes or more throw std::length_error.
+    void buildFromEdges(std::span<const std::pair<T, T>> edges);
+
+  protected:
+    // Fills the node map and returns the rows of the graph, which must be
+    // empty. Throws std::length_error, leaving the graph empty, if the arcs
+    // of that many nodes cannot be packed in 64 bits.
+    [[nodiscard]] internals::builtAdjacency<IndexType> internal_buildAdjacency(
+        std::span<const std::pair<T, T>> edges, bool keepSourceEdges = false);
+
+    // Copies the rows into the storage of the implementation, the node map
+    // being already filled
+    virtual void internal_assignBuiltAdjacency(
+        const internals::builtAdjacency<IndexType> &adjacency) = 0;
+};
+
+template <typename T, typename IndexType>
+void GraphBuilder<T, IndexType>::buildFromEdges(
+    std::span<const std::pair<T, T>> edges)
+{
+    this->clear();
+    internal_assignBuiltAdjacency(internal_buildAdjacency(edges));
+}
+
+template <typename T, typename IndexType>
+internals::builtAdjacency<IndexType> GraphBuilder<
+    T, IndexType>::internal_buildAdjacency(std::span<const std::pair<T, T>>
+                                               edges,
+                                           bool keepSourceEdges)
+{
+    assert(this->getNumberOfNodes() == 0);
+
+    // Endpoints sorted by name, radix sorted for integral names, numbered
+    // in one pass over the sorted names
+    std::vector<std::pair<T, size_t>> endpoints;
+    endpoints.reserve(2 * edges.size());
+    for (const auto &[first, second] : edges)
+    {
+        endpoints.emplace_back(first, endpoints.size());
+        endpoints.emplace_back(second, endpoints.size());
+    }
+    if constexpr (std::integral<T>)
+    {
+        internals::parallelRadixSort(
+            endpoints, 8 * sizeof(T), [](const auto &endpoint) {
+                // Flipping the sign bit orders signed names as unsigned ones
+                constexpr auto signBit =
+                    std::is_signed_v<T> ? uint64_t{1} << ((8 * sizeof(T)) - 1)
+                                        : 0;
+                return static_cast<uint64_t>(
+                           static_cast<std::make_unsigned_t<T>>(
+                               endpoint.first)) ^
+                       signBit;
+            });
+    }
+    else
+    {
+        internals::parallelSort(endpoints.begin(), endpoints.end());
+    }
+
+    std::vector<uint64_t> endpointIndexes(endpoints.size());
+    this->getNodeMap().reserve(endpoints.size());
+    for (size_t i = 0; i < endpoints.size(); i++)
+    {
+        if (i == 0 || endpoints[i].first != endpoints[i - 1].first)
+            this->getNodeMap().addByName(endpoints[i].first);
+        endpointIndexes[endpoints[i].second] = this->getNodeMap().getSize() - 1;
+    }
+    this->getNodeMap().shrinkToFit();
+
+    // Arcs packed as from * 2^nodeBits + to, so that sorting the keys sorts
+    // the arcs by row, then by neighbor
+    const auto numberOfNodes = this->getNodeMap().getSize();
+    const auto nodeBits = static_cast<unsigned>(std::bit_width(numberOfNodes));
+    if (2 * nodeBits > 64)
+    {
+        this->clear();
+        throw std::length_error("Too many nodes to pack arcs in 64 bits");
+    }
+    const auto directed = this->isDirected();
+    const size_t arcsPerEdge = directed ? 1 : 2;
+
+    internals::builtAdjacency<IndexType> result;
+    result.offsets.assign(numberOfNodes + 1, 0);
+    const auto toMask = (uint64_t{1} << nodeBits) - 1;
+
+    // Arcs only carry the position of their edge if asked, the sort moving
+    // half the data otherwise
+    const auto groupArcs = [&]<typename Arc>(auto makeArc, auto keyOf) {
+        std::vector<Arc> arcs(arcsPerEdge * edges.size());
+        internals::parallelFor(
+            edges.size(),
+            [&](size_t, size_t edge) {
+                const auto from = endpointIndexes[2 * edge];
+                const auto to = endpointIndexes[(2 * edge) + 1];
+                arcs[arcsPerEdge * edge] =
+                    makeArc((from << nodeBits) | to, edge);
+                if (!directed)
+                {
+                    arcs[(2 * edge) + 1] =
+                        makeArc((to << nodeBits) | from, edge);
+                }
+            },
+            1024);
+
+        // The sort is stable, so the first of repeated arcs comes from the
+        // first of repeated edges
+        internals::parallelRadixSort(arcs, 2 * nodeBits, keyOf);
+        arcs.erase(std::unique(arcs.begin(), arcs.end(),
+                               [&](const auto &first, const auto &second) {
+                                   return keyOf(first) == keyOf(second);
+                               }),
+                   arcs.end());
+
+        for (const auto &arc : arcs)
+            result.offsets[static_cast<size_t>(keyOf(arc) >> nodeBits) + 1]++;
+        for (size_t node = 0; node < numberOfNodes; node++)
+            result.offsets[node + 1] += result.offsets[node];
+
+        // Arcs are already grouped by row, in row order
+        result.neighbors.resize(arcs.size());
+        internals::parallelFor(
+            arcs.size(),
+            [&](size_t, size_t arc) {
+                result.neighbors[arc] =
+                    static_cast<IndexType>(keyOf(arcs[arc]) & toMask);
+            },
+            4096);
+        return arcs;
+    };
+
+    if (!keepSourceEdges)
+    {
+        groupArcs.template operator()<uint64_t>(
+            [](uint64_t key, size_t) { return key; },
+            [](uint64_t arc) { return arc; });
+        return result;
+    }
+
+    using sourcedArc = std::pair<uint64_t, size_t>;
+    const auto arcs = groupArcs.template operator()<sourcedArc>(
+        [](uint64_t key, size_t edge) { return sourcedArc(key, edge); },
+        [](const sourcedArc &arc) { return arc.first; });
+    result.sourceEdges.resize(arcs.size());
+    for (size_t arc = 0; arc < arcs.size(); arc++)
+        result.sourceEdges[arc] = arcs[arc].second;
+    return result;
+}
+
+} // namespace jGraph
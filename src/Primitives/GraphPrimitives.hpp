@@ -1,9 +1,13 @@
 #pragma once
 
+#include "CompressedAdjacency.hpp"
 #include "Concepts.hpp"
 #include "DefaultTypes.hpp"
+#include "DegreeCounters.hpp"
 #include "NameIndexMap.hpp"
+#include "Parallel.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
 #include <span>
@@ -36,6 +40,9 @@ class GraphPrimitives
     constexpr virtual void addNode(std::span<T> nodes) = 0;
 
     constexpr virtual void removeNode(T) = 0;
+    // Removes the nodes at once, in a single pass over the graph whatever
+    // their number. Remaining nodes keep their order.
+    constexpr virtual void removeNode(std::span<T> nodes) = 0;
 
     constexpr virtual void addEdge(std::pair<T, T>) = 0;
     constexpr virtual void addEdge(
@@ -43,6 +50,9 @@ class GraphPrimitives
     constexpr virtual void addEdge(std::span<std::pair<T, T>> edges) = 0;
 
     constexpr virtual void removeEdge(std::pair<T, T>) = 0;
+    // Removes the edges at once, each touched neighbor list being rewritten
+    // once. Edges between nodes not in the graph are ignored.
+    constexpr virtual void removeEdge(std::span<std::pair<T, T>> edges) = 0;
 
     [[nodiscard]] constexpr virtual size_t getNumberOfNodes() const = 0;
     [[nodiscard]] constexpr virtual size_t getNumberOfEdges() const = 0;
@@ -60,13 +70,41 @@ class GraphPrimitives
     [[nodiscard]] constexpr const jGraph::internals::NameIndexMap<T,
                                                                   IndexType> &
     getNodeMap() const;
+
+    // Kept up to date by the implementations whenever nodes or edges change
+    [[nodiscard]] constexpr internals::DegreeCounters<IndexType> &
+    getDegreeCounters();
+    [[nodiscard]] constexpr const internals::DegreeCounters<IndexType> &
+    getDegreeCounters() const;
+
     [[nodiscard]] constexpr virtual std::vector<IndexType> internal_getNodes()
         const = 0;
     [[nodiscard]] constexpr virtual std::vector<
         IndexType> internal_getNeighbors(IndexType) const = 0;
 
+    // Nodes reachable by following one edge out of the given node, paired
+    // with the weight of that edge. Directed graphs only report outgoing
+    // edges, unweighted graphs report a weight of 1.
+    [[nodiscard]] constexpr virtual std::vector<std::pair<IndexType, double>>
+    internal_getWeightedNeighbors(IndexType index) const;
+
+    // Snapshot of internal_getNeighbors for every node. Implementations that
+    // can lay out their rows directly override it with a linear time builder
+    // instead of going through the virtual accessor node by node.
+    [[nodiscard]] constexpr virtual internals::CompressedAdjacency<IndexType>
+    internal_compressNeighbors() const;
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_compressOutgoingNeighbors(bool withWeights) const;
+
+    // Undirected view of the graph, weighted if the graph is weighted and
+    // undirected. Directed graphs have no weights to merge, so their
+    // internal_getNeighbors view is used as is.
+    [[nodiscard]] constexpr internals::CompressedAdjacency<IndexType>
+    internal_compressUndirectedNeighbors() const;
+
   private:
     jGraph::internals::NameIndexMap<T, IndexType> nodeMap;
+    internals::DegreeCounters<IndexType> degreeCounters;
 };
 
 template <typename T, typename IndexType>
@@ -85,6 +123,103 @@ constexpr const jGraph::internals::NameIndexMap<T, IndexType> &GraphPrimitives<
     return nodeMap;
 }
 
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr internals::DegreeCounters<IndexType> &GraphPrimitives<
+    T, IndexType>::getDegreeCounters()
+{
+    return degreeCounters;
+}
+
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr const internals::DegreeCounters<IndexType> &GraphPrimitives<
+    T, IndexType>::getDegreeCounters() const
+{
+    return degreeCounters;
+}
+
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr std::vector<std::pair<IndexType, double>> GraphPrimitives<
+    T, IndexType>::internal_getWeightedNeighbors(IndexType index) const
+{
+    std::vector<std::pair<IndexType, double>> result;
+    const auto neighbors = internal_getNeighbors(index);
+    result.reserve(neighbors.size());
+
+    for (const auto neighbor : neighbors)
+    {
+        result.emplace_back(neighbor, 1.0);
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphPrimitives<
+    T, IndexType>::internal_compressNeighbors() const
+{
+    const auto numNodes = getNumberOfNodes();
+
+    // Rows are read in parallel, then laid out one after the other
+    std::vector<std::vector<IndexType>> rows(numNodes);
+    internals::parallelFor(
+        numNodes,
+        [&](size_t, size_t node) {
+            rows[node] = internal_getNeighbors(static_cast<IndexType>(node));
+        },
+        64);
+
+    std::vector<size_t> offsets(numNodes + 1, 0);
+    for (size_t node = 0; node < numNodes; node++)
+        offsets[node + 1] = offsets[node] + rows[node].size();
+
+    std::vector<IndexType> neighbors(offsets.back());
+    internals::parallelFor(
+        numNodes,
+        [&](size_t, size_t node) {
+            std::ranges::copy(rows[node],
+                              neighbors.begin() +
+                                  static_cast<std::ptrdiff_t>(offsets[node]));
+        },
+        256);
+    return {std::move(offsets), std::move(neighbors)};
+}
+
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphPrimitives<
+    T, IndexType>::internal_compressOutgoingNeighbors(bool withWeights) const
+{
+    const auto numNodes = getNumberOfNodes();
+    internals::CompressedAdjacency<IndexType> result(numNodes);
+
+    for (size_t node = 0; node < numNodes; node++)
+    {
+        for (const auto &[neighbor, weight] :
+             internal_getWeightedNeighbors(static_cast<IndexType>(node)))
+        {
+            if (withWeights)
+                result.appendNeighbor(neighbor, weight);
+            else
+                result.appendNeighbor(neighbor);
+        }
+        result.closeRow();
+    }
+    return result;
+}
+
+template <typename T, typename IndexType>
+    requires internals::Integral<IndexType>
+constexpr internals::CompressedAdjacency<IndexType> GraphPrimitives<
+    T, IndexType>::internal_compressUndirectedNeighbors() const
+{
+    if (isDirected() || !isWeighted())
+        return internal_compressNeighbors();
+    return internal_compressOutgoingNeighbors(true);
+}
+
 template <typename T, typename IndexType>
     requires internals::Integral<IndexType>
 constexpr void GraphPrimitives<T, IndexType>::addNode(
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Read-only snapshot of a graph in compressed sparse row form. Algorithms that
+// traverse the graph many times build it once so that every traversal reads
+// contiguous memory instead of going through the virtual neighbor accessors.
+template <typename IndexType>
+class CompressedAdjacency
+{
+  public:
+    constexpr CompressedAdjacency() = default;
+    constexpr explicit CompressedAdjacency(size_t numberOfNodes);
+    // Takes rows already laid out, the row of a node being
+    // [rowOffsets[node], rowOffsets[node + 1]) in rowNeighbors
+    constexpr CompressedAdjacency(std::vector<size_t> rowOffsets,
+                                  std::vector<IndexType> rowNeighbors);
+
+    constexpr void appendNeighbor(IndexType neighbor);
+    constexpr void appendNeighbor(IndexType neighbor, double weight);
+    constexpr void closeRow();
+
+    // Sorts every row and drops repeated neighbors, and self-loops unless
+    // kept. Only meant for unweighted snapshots, whose weights could not
+    // follow the reordering.
+    constexpr void sortAndDeduplicateRows(bool keepSelfLoops = true);
+
+    [[nodiscard]] constexpr size_t getNumberOfNodes() const;
+    [[nodiscard]] constexpr size_t getNumberOfArcs() const;
+    [[nodiscard]] constexpr bool isWeighted() const;
+
+    [[nodiscard]] constexpr size_t getDegree(IndexType node) const;
+    [[nodiscard]] constexpr size_t getRowOffset(IndexType node) const;
+    [[nodiscard]] constexpr std::span<const IndexType> getNeighbors(
+        IndexType node) const;
+    [[nodiscard]] constexpr std::span<const double> getWeights(
+        IndexType node) const;
+
+    // Binary search, rows must have been sorted
+    [[nodiscard]] constexpr bool containsNeighbor(IndexType node,
+                                                  IndexType neighbor) const;
+
+  private:
+    std::vector<size_t> offsets{0};
+    std::vector<IndexType> neighbors;
+    std::vector<double> weights;
+};
+
+template <typename IndexType>
+constexpr CompressedAdjacency<IndexType>::CompressedAdjacency(
+    size_t numberOfNodes)
+{
+    offsets.reserve(numberOfNodes + 1);
+}
+
+template <typename IndexType>
+constexpr CompressedAdjacency<IndexType>::CompressedAdjacency(
+    std::vector<size_t> rowOffsets, std::vector<IndexType> rowNeighbors)
+    : offsets(std::move(rowOffsets)), neighbors(std::move(rowNeighbors))
+{
+    assert(!offsets.empty() && offsets.back() == neighbors.size());
+}
+
+template <typename IndexType>
+constexpr void CompressedAdjacency<IndexType>::appendNeighbor(
+    IndexType neighbor)
+{
+    neighbors.emplace_back(neighbor);
+}
+
+template <typename IndexType>
+constexpr void CompressedAdjacency<IndexType>::appendNeighbor(
+    IndexType neighbor, double weight)
+{
+    neighbors.emplace_back(neighbor);
+    weights.emplace_back(weight);
+}
+
+template <typename IndexType>
+constexpr void CompressedAdjacency<IndexType>::closeRow()
+{
+    offsets.emplace_back(neighbors.size());
+}
+
+template <typename IndexType>
+constexpr void CompressedAdjacency<IndexType>::sortAndDeduplicateRows(
+    bool keepSelfLoops)
+{
+    assert(weights.empty());
+    size_t kept = 0;
+    for (size_t row = 0; row + 1 < offsets.size(); row++)
+    {
+        const auto begin = neighbors.begin() +
+                           static_cast<std::ptrdiff_t>(offsets[row]);
+        const auto end = neighbors.begin() +
+                         static_cast<std::ptrdiff_t>(offsets[row + 1]);
+        // Snapshots of sorted neighbor lists need no sorting
+        if (!std::is_sorted(begin, end))
+            std::sort(begin, end);
+        const auto uniqueEnd = std::unique(begin, end);
+
+        offsets[row] = kept;
+        for (auto it = begin; it != uniqueEnd; ++it)
+        {
+            if (keepSelfLoops || static_cast<size_t>(*it) != row)
+                neighbors[kept++] = *it;
+        }
+    }
+    offsets.back() = kept;
+    neighbors.resize(kept);
+}
+
+template <typename IndexType>
+constexpr size_t CompressedAdjacency<IndexType>::getNumberOfNodes() const
+{
+    return offsets.size() - 1;
+}
+
+template <typename IndexType>
+constexpr size_t CompressedAdjacency<IndexType>::getNumberOfArcs() const
+{
+    return neighbors.size();
+}
+
+template <typename IndexType>
+constexpr bool CompressedAdjacency<IndexType>::isWeighted() const
+{
+    return !weights.empty();
+}
+
+template <typename IndexType>
+constexpr size_t CompressedAdjacency<IndexType>::getDegree(
+    IndexType node) const
+{
+    const auto row = static_cast<size_t>(node);
+    return offsets[row + 1] - offsets[row];
+}
+
+template <typename IndexType>
+constexpr size_t CompressedAdjacency<IndexType>::getRowOffset(
+    IndexType node) const
+{
+    return offsets[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr std::span<const IndexType> CompressedAdjacency<
+    IndexType>::getNeighbors(IndexType node) const
+{
+    const auto row = static_cast<size_t>(node);
+    return std::span<const IndexType>(neighbors).subspan(
+        offsets[row], offsets[row + 1] - offsets[row]);
+}
+
+template <typename IndexType>
+constexpr std::span<const double> CompressedAdjacency<IndexType>::getWeights(
+    IndexType node) const
+{
+    if (weights.empty())
+        return {};
+
+    const auto row = static_cast<size_t>(node);
+    return std::span<const double>(weights).subspan(
+        offsets[row], offsets[row + 1] - offsets[row]);
+}
+
+template <typename IndexType>
+constexpr bool CompressedAdjacency<IndexType>::containsNeighbor(
+    IndexType node, IndexType neighbor) const
+{
+    return std::ranges::binary_search(getNeighbors(node), neighbor);
+}
+
+} // namespace jGraph::internals
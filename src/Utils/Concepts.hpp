@@ -2,6 +2,7 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <functional>
 #include <type_traits>
@@ -12,6 +13,12 @@ namespace jGraph::internals
 template <typename T>
 concept Integral = std::is_integral_v<T>;
 
+// Integral names that fit in 64 bits, which can be told apart by their
+// distance to another one
+template <typename T>
+concept DenseKeyType = std::integral<T> && !std::same_as<T, bool> &&
+                       sizeof(T) <= sizeof(std::uint64_t);
+
 template <typename T>
 concept ValidKeyType =
     std::copyable<T> && std::totally_ordered<T> && requires(T keyType) {
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Degrees of every node, kept up to date by the graph implementations as
+// edges come and go so that reading one never walks the structure. The
+// degree of a node is the size of its neighbor list: on directed graphs, the
+// number of nodes linked to it in either direction. Undirected graphs have
+// in and out degrees equal to their degrees.
+template <typename IndexType>
+class DegreeCounters
+{
+  public:
+    constexpr void addNodes(size_t count);
+    // The last node takes the place of the removed one, like in the graphs
+    constexpr void removeNode(IndexType node);
+    // Moves the counters of every node to its new index, the ones of nodes
+    // whose new index is past the remaining ones being dropped
+    constexpr void removeNodes(std::span<const IndexType> newIndexes,
+                               size_t remainingNodes);
+    constexpr void clear();
+
+    // An undirected graph added or removed an entry of the neighbor list of
+    // the node
+    constexpr void addNeighbor(IndexType node);
+    constexpr void removeNeighbor(IndexType node);
+
+    // A directed graph added or removed the arc from -> to, reverseArc
+    // telling whether the arc to -> from exists, the arc itself aside: the
+    // nodes are only linked or unlinked if it does not
+    constexpr void addArc(IndexType from, IndexType to, bool reverseArc);
+    constexpr void removeArc(IndexType from, IndexType to, bool reverseArc);
+
+    // Batch removals subtract the links a node lost at once, only touching
+    // the counters of that node so that nodes can be updated in parallel
+    constexpr void removeLinks(IndexType node, size_t degree, size_t inDegree,
+                               size_t outDegree);
+
+    [[nodiscard]] constexpr size_t getDegree(IndexType node) const;
+    [[nodiscard]] constexpr size_t getInDegree(IndexType node) const;
+    [[nodiscard]] constexpr size_t getOutDegree(IndexType node) const;
+
+    [[nodiscard]] constexpr std::span<const size_t> getDegrees() const;
+    [[nodiscard]] constexpr std::span<const size_t> getInDegrees() const;
+    [[nodiscard]] constexpr std::span<const size_t> getOutDegrees() const;
+
+  private:
+    std::vector<size_t> degrees;
+    std::vector<size_t> inDegrees;
+    std::vector<size_t> outDegrees;
+};
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::addNodes(size_t count)
+{
+    for (auto *counters : {&degrees, &inDegrees, &outDegrees})
+        counters->resize(counters->size() + count, 0);
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::removeNode(IndexType node)
+{
+    for (auto *counters : {&degrees, &inDegrees, &outDegrees})
+    {
+        (*counters)[static_cast<size_t>(node)] = counters->back();
+        counters->pop_back();
+    }
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::removeNodes(
+    std::span<const IndexType> newIndexes, size_t remainingNodes)
+{
+    // New indexes keep the order of the old ones, so moving down is enough
+    for (auto *counters : {&degrees, &inDegrees, &outDegrees})
+    {
+        for (size_t node = 0; node < newIndexes.size(); node++)
+        {
+            const auto newIndex = static_cast<size_t>(newIndexes[node]);
+            if (newIndex < remainingNodes)
+                (*counters)[newIndex] = (*counters)[node];
+        }
+        counters->resize(remainingNodes);
+    }
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::clear()
+{
+    degrees.clear();
+    inDegrees.clear();
+    outDegrees.clear();
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::addNeighbor(IndexType node)
+{
+    const auto index = static_cast<size_t>(node);
+    degrees[index]++;
+    inDegrees[index]++;
+    outDegrees[index]++;
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::removeNeighbor(IndexType node)
+{
+    const auto index = static_cast<size_t>(node);
+    assert(degrees[index] > 0);
+    degrees[index]--;
+    inDegrees[index]--;
+    outDegrees[index]--;
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::addArc(IndexType from, IndexType to,
+                                                 bool reverseArc)
+{
+    outDegrees[static_cast<size_t>(from)]++;
+    inDegrees[static_cast<size_t>(to)]++;
+    if (reverseArc)
+        return;
+
+    degrees[static_cast<size_t>(from)]++;
+    if (from != to)
+        degrees[static_cast<size_t>(to)]++;
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::removeArc(IndexType from,
+                                                    IndexType to,
+                                                    bool reverseArc)
+{
+    assert(outDegrees[static_cast<size_t>(from)] > 0);
+    assert(inDegrees[static_cast<size_t>(to)] > 0);
+    outDegrees[static_cast<size_t>(from)]--;
+    inDegrees[static_cast<size_t>(to)]--;
+    if (reverseArc)
+        return;
+
+    degrees[static_cast<size_t>(from)]--;
+    if (from != to)
+        degrees[static_cast<size_t>(to)]--;
+}
+
+template <typename IndexType>
+constexpr void DegreeCounters<IndexType>::removeLinks(IndexType node,
+                                                      size_t degree,
+                                                      size_t inDegree,
+                                                      size_t outDegree)
+{
+    const auto index = static_cast<size_t>(node);
+    assert(degrees[index] >= degree);
+    assert(inDegrees[index] >= inDegree);
+    assert(outDegrees[index] >= outDegree);
+    degrees[index] -= degree;
+    inDegrees[index] -= inDegree;
+    outDegrees[index] -= outDegree;
+}
+
+template <typename IndexType>
+constexpr size_t DegreeCounters<IndexType>::getDegree(IndexType node) const
+{
+    return degrees[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr size_t DegreeCounters<IndexType>::getInDegree(IndexType node) const
+{
+    return inDegrees[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr size_t DegreeCounters<IndexType>::getOutDegree(IndexType node) const
+{
+    return outDegrees[static_cast<size_t>(node)];
+}
+
+template <typename IndexType>
+constexpr std::span<const size_t> DegreeCounters<IndexType>::getDegrees() const
+{
+    return degrees;
+}
+
+template <typename IndexType>
+constexpr std::span<const size_t> DegreeCounters<IndexType>::getInDegrees()
+    const
+{
+    return inDegrees;
+}
+
+template <typename IndexType>
+constexpr std::span<const size_t> DegreeCounters<IndexType>::getOutDegrees()
+    const
+{
+    return outDegrees;
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Union-find over [0, size) with union by size and path halving
+template <typename IndexType>
+class DisjointSets
+{
+  public:
+    constexpr explicit DisjointSets(size_t size);
+
+    [[nodiscard]] constexpr IndexType find(IndexType element);
+
+    // Returns false if both elements already were in the same set
+    constexpr bool unite(IndexType first, IndexType second);
+
+    [[nodiscard]] constexpr size_t getNumberOfSets() const;
+
+  private:
+    std::vector<IndexType> parents;
+    std::vector<size_t> sizes;
+    size_t numberOfSets;
+};
+
+template <typename IndexType>
+constexpr DisjointSets<IndexType>::DisjointSets(size_t size)
+    : parents(size), sizes(size, 1), numberOfSets(size)
+{
+    std::iota(parents.begin(), parents.end(), IndexType{0});
+}
+
+template <typename IndexType>
+constexpr IndexType DisjointSets<IndexType>::find(IndexType element)
+{
+    auto current = static_cast<size_t>(element);
+    while (static_cast<size_t>(parents[current]) != current)
+    {
+        const auto parent = static_cast<size_t>(parents[current]);
+        parents[current] = parents[parent];
+        current = static_cast<size_t>(parents[current]);
+    }
+    return static_cast<IndexType>(current);
+}
+
+template <typename IndexType>
+constexpr bool DisjointSets<IndexType>::unite(IndexType first,
+                                              IndexType second)
+{
+    auto firstRoot = static_cast<size_t>(find(first));
+    auto secondRoot = static_cast<size_t>(find(second));
+    if (firstRoot == secondRoot)
+        return false;
+
+    if (sizes[firstRoot] < sizes[secondRoot])
+        std::swap(firstRoot, secondRoot);
+
+    parents[secondRoot] = static_cast<IndexType>(firstRoot);
+    sizes[firstRoot] += sizes[secondRoot];
+    numberOfSets--;
+    return true;
+}
+
+template <typename IndexType>
+constexpr size_t DisjointSets<IndexType>::getNumberOfSets() const
+{
+    return numberOfSets;
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// splitmix64 finalizer, used to turn node indexes into well spread hashes
+[[nodiscard]] constexpr uint64_t mixHash(uint64_t value, uint64_t seed)
+{
+    uint64_t result = value + seed + 0x9e3779b97f4a7c15ULL;
+    result = (result ^ (result >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    result = (result ^ (result >> 27U)) * 0x94d049bb133111ebULL;
+    return result ^ (result >> 31U);
+}
+
+// A fixed number of HyperLogLog counters stored back to back in a single
+// register array, so that merging two counters is a max over two contiguous
+// byte ranges which the compiler turns into vector instructions.
+class HyperLogLogCounters
+{
+  public:
+    static constexpr uint8_t MIN_LOG2_REGISTERS = 4;
+    static constexpr uint8_t MAX_LOG2_REGISTERS = 16;
+
+    HyperLogLogCounters(size_t numberOfCounters, uint8_t log2Registers);
+
+    void add(size_t counter, uint64_t hash);
+
+    // Merges the other counter into this one and reports whether any
+    // register grew
+    bool merge(size_t counter, const HyperLogLogCounters &other,
+               size_t otherCounter);
+
+    [[nodiscard]] double estimate(size_t counter) const;
+
+  private:
+    uint8_t log2Registers;
+    size_t registersPerCounter;
+    std::vector<uint8_t> registers;
+
+    [[nodiscard]] std::span<uint8_t> getRegisters(size_t counter);
+    [[nodiscard]] std::span<const uint8_t> getRegisters(size_t counter) const;
+};
+
+inline HyperLogLogCounters::HyperLogLogCounters(size_t numberOfCounters,
+                                                uint8_t log2RegistersCount)
+    : log2Registers(std::clamp(log2RegistersCount, MIN_LOG2_REGISTERS,
+                               MAX_LOG2_REGISTERS)),
+      registersPerCounter(size_t{1} << log2Registers),
+      registers(numberOfCounters * registersPerCounter, 0)
+{
+}
+
+inline void HyperLogLogCounters::add(size_t counter, uint64_t hash)
+{
+    const auto registerIndex =
+        static_cast<size_t>(hash >> (64U - log2Registers));
+    const uint64_t remainingBits = hash << log2Registers;
+    const auto rank = static_cast<uint8_t>(
+        std::min(std::countl_zero(remainingBits), 64 - log2Registers) + 1);
+
+    auto &value = getRegisters(counter)[registerIndex];
+    value = std::max(value, rank);
+}
+
+inline bool HyperLogLogCounters::merge(size_t counter,
+                                       const HyperLogLogCounters &other,
+                                       size_t otherCounter)
+{
+    auto destination = getRegisters(counter);
+    const auto source = other.getRegisters(otherCounter);
+
+    uint8_t grew = 0;
+    for (size_t i = 0; i < destination.size(); i++)
+    {
+        grew |= static_cast<uint8_t>(source[i] > destination[i]);
+        destination[i] = std::max(destination[i], source[i]);
+    }
+    return grew != 0;
+}
+
+inline double HyperLogLogCounters::estimate(size_t counter) const
+{
+    const auto counterRegisters = getRegisters(counter);
+    const auto numRegisters = static_cast<double>(registersPerCounter);
+
+    double harmonicSum = 0;
+    size_t emptyRegisters = 0;
+    for (const auto value : counterRegisters)
+    {
+        harmonicSum += std::ldexp(1.0, -static_cast<int>(value));
+        if (value == 0)
+            emptyRegisters++;
+    }
+
+    double alpha = 0.7213 / (1 + (1.079 / numRegisters));
+    if (registersPerCounter == 16)
+        alpha = 0.673;
+    else if (registersPerCounter == 32)
+        alpha = 0.697;
+    else if (registersPerCounter == 64)
+        alpha = 0.709;
+
+    const double rawEstimate =
+        alpha * numRegisters * numRegisters / harmonicSum;
+
+    // Linear counting is more accurate while many registers are still empty
+    if (rawEstimate <= 2.5 * numRegisters && emptyRegisters != 0)
+    {
+        return numRegisters *
+               std::log(numRegisters / static_cast<double>(emptyRegisters));
+    }
+    return rawEstimate;
+}
+
+inline std::span<uint8_t> HyperLogLogCounters::getRegisters(size_t counter)
+{
+    return std::span<uint8_t>(registers).subspan(
+        counter * registersPerCounter, registersPerCounter);
+}
+
+inline std::span<const uint8_t> HyperLogLogCounters::getRegisters(
+    size_t counter) const
+{
+    return std::span<const uint8_t>(registers).subspan(
+        counter * registersPerCounter, registersPerCounter);
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Binary heap over the items [0, capacity) that knows where every item sits,
+// so that the key of a queued item can be changed in O(log n). The item on
+// top is the one whose key compares first with Compare.
+template <typename IndexType, typename Compare = std::less<double>>
+class IndexedHeap
+{
+  public:
+    constexpr explicit IndexedHeap(size_t capacity);
+
+    [[nodiscard]] constexpr bool empty() const;
+    [[nodiscard]] constexpr bool contains(IndexType item) const;
+    [[nodiscard]] constexpr double getKey(IndexType item) const;
+    [[nodiscard]] constexpr std::pair<IndexType, double> top() const;
+
+    // Queues the item, or moves it if it already is queued
+    constexpr void push(IndexType item, double key);
+
+    // Queues the item, or moves it if the new key compares before the
+    // current one. Returns false if the key was not improved.
+    constexpr bool pushOrImprove(IndexType item, double key);
+
+    constexpr std::pair<IndexType, double> pop();
+
+  private:
+    static constexpr size_t NOT_QUEUED = std::numeric_limits<size_t>::max();
+
+    std::vector<IndexType> heap;
+    std::vector<size_t> positions;
+    std::vector<double> keys;
+    Compare compare;
+
+    constexpr void siftUp(size_t position);
+    constexpr void siftDown(size_t position);
+    constexpr void place(size_t position, IndexType item);
+};
+
+template <typename IndexType, typename Compare>
+constexpr IndexedHeap<IndexType, Compare>::IndexedHeap(size_t capacity)
+    : positions(capacity, NOT_QUEUED), keys(capacity, 0)
+{
+    heap.reserve(capacity);
+}
+
+template <typename IndexType, typename Compare>
+constexpr bool IndexedHeap<IndexType, Compare>::empty() const
+{
+    return heap.empty();
+}
+
+template <typename IndexType, typename Compare>
+constexpr bool IndexedHeap<IndexType, Compare>::contains(IndexType item) const
+{
+    return positions[static_cast<size_t>(item)] != NOT_QUEUED;
+}
+
+template <typename IndexType, typename Compare>
+constexpr double IndexedHeap<IndexType, Compare>::getKey(IndexType item) const
+{
+    return keys[static_cast<size_t>(item)];
+}
+
+template <typename IndexType, typename Compare>
+constexpr std::pair<IndexType, double> IndexedHeap<IndexType, Compare>::top()
+    const
+{
+    return {heap.front(), keys[static_cast<size_t>(heap.front())]};
+}
+
+template <typename IndexType, typename Compare>
+constexpr void IndexedHeap<IndexType, Compare>::push(IndexType item,
+                                                     double key)
+{
+    const auto index = static_cast<size_t>(item);
+    if (positions[index] == NOT_QUEUED)
+    {
+        keys[index] = key;
+        heap.emplace_back(item);
+        positions[index] = heap.size() - 1;
+        siftUp(heap.size() - 1);
+        return;
+    }
+
+    const bool movesUp = compare(key, keys[index]);
+    keys[index] = key;
+    if (movesUp)
+        siftUp(positions[index]);
+    else
+        siftDown(positions[index]);
+}
+
+template <typename IndexType, typename Compare>
+constexpr bool IndexedHeap<IndexType, Compare>::pushOrImprove(IndexType item,
+                                                              double key)
+{
+    const auto index = static_cast<size_t>(item);
+    if (positions[index] != NOT_QUEUED && !compare(key, keys[index]))
+        return false;
+
+    push(item, key);
+    return true;
+}
+
+template <typename IndexType, typename Compare>
+constexpr std::pair<IndexType, double> IndexedHeap<IndexType, Compare>::pop()
+{
+    const auto result = top();
+    positions[static_cast<size_t>(result.first)] = NOT_QUEUED;
+
+    const auto last = heap.back();
+    heap.pop_back();
+    if (!heap.empty())
+    {
+        place(0, last);
+        siftDown(0);
+    }
+    return result;
+}
+
+template <typename IndexType, typename Compare>
+constexpr void IndexedHeap<IndexType, Compare>::siftUp(size_t position)
+{
+    const auto item = heap[position];
+    const auto key = keys[static_cast<size_t>(item)];
+    while (position > 0)
+    {
+        const auto parent = (position - 1) / 2;
+        if (!compare(key, keys[static_cast<size_t>(heap[parent])]))
+            break;
+        place(position, heap[parent]);
+        position = parent;
+    }
+    place(position, item);
+}
+
+template <typename IndexType, typename Compare>
+constexpr void IndexedHeap<IndexType, Compare>::siftDown(size_t position)
+{
+    const auto item = heap[position];
+    const auto key = keys[static_cast<size_t>(item)];
+    while (true)
+    {
+        auto child = (2 * position) + 1;
+        if (child >= heap.size())
+            break;
+        if (child + 1 < heap.size() &&
+            compare(keys[static_cast<size_t>(heap[child + 1])],
+                    keys[static_cast<size_t>(heap[child])]))
+            child++;
+        if (!compare(keys[static_cast<size_t>(heap[child])], key))
+            break;
+        place(position, heap[child]);
+        position = child;
+    }
+    place(position, item);
+}
+
+template <typename IndexType, typename Compare>
+constexpr void IndexedHeap<IndexType, Compare>::place(size_t position,
+                                                      IndexType item)
+{
+    heap[position] = item;
+    positions[static_cast<size_t>(item)] = position;
+}
+
+} // namespace jGraph::internals
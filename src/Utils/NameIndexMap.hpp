@@ -2,17 +2,49 @@
 
 #include "Concepts.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <span>
-#include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-namespace jGraph::internals
+namespace jGraph
 {
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
+// How node names are turned into indexes
+enum NameMapping : std::uint8_t
+{
+    // Open addressing hash table of indexes, probed linearly
+    FLAT_HASH,
+    // Table of indexes read at the offset of every name from the smallest
+    // one, for dense integral names: converting a name is a subtraction and
+    // a load. The table spans a few slots per name at most, falling back to
+    // FLAT_HASH while names are sparser than that.
+    DENSE_OFFSET
+};
+
+// Mapping used by the graphs for names of type T, which can be specialized
+// to pick the other one
+template <typename T>
+inline constexpr NameMapping nameMapping =
+    internals::DenseKeyType<T> ? DENSE_OFFSET : FLAT_HASH;
+
+namespace internals
+{
+
+// Names of the nodes by index and indexes by name. Both mappings keep the
+// indexes in a flat table pointing into the names instead of storing the
+// names twice. Names unknown to the map throw std::out_of_range when
+// converted.
+template <typename T, typename IndexType, NameMapping Mapping = nameMapping<T>>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
 class NameIndexMap
 {
 
@@ -25,8 +57,17 @@ class NameIndexMap
 
     [[nodiscard]] constexpr bool contains(T key) const;
 
+    // The last name takes the index of the removed one, so that no other
+    // index changes and removing is constant time
     constexpr void removeByName(T name);
     constexpr void removeByIndex(IndexType index);
+    // Removes the names at once, the remaining ones keeping their order, and
+    // returns the new index of every old one, REMOVED_INDEX for the removed
+    // ones
+    constexpr std::vector<IndexType> removeByName(std::span<const T> names);
+
+    static constexpr IndexType REMOVED_INDEX =
+        std::numeric_limits<IndexType>::max();
 
     [[nodiscard]] constexpr T convertIndexToNodeName(IndexType index) const;
     [[nodiscard]] constexpr std::vector<T> convertIndexToNodeName(
@@ -43,77 +84,155 @@ class NameIndexMap
 
     constexpr void reserve(size_t size);
     constexpr void shrinkToFit();
+    constexpr void clear();
 
   private:
+    static constexpr IndexType EMPTY_SLOT =
+        std::numeric_limits<IndexType>::max();
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr uint64_t GOLDEN_RATIO = 0x9e3779b97f4a7c15U;
+    // A dense table spans at most DENSE_SPREAD slots per name, or
+    // MIN_DENSE_SPAN slots for the first few names
+    static constexpr size_t DENSE_SPREAD = 4;
+    static constexpr size_t MIN_DENSE_SPAN = 64;
+
     std::vector<T> indexToName;
-    std::unordered_map<T, IndexType> nameToIndex;
+    // Indexes of the names, in hash order or at the offset of their name
+    std::vector<IndexType> slots;
+    bool hashed = Mapping == FLAT_HASH;
+    unsigned shift = 64;
+    // Key of the name of the first slot of a dense table
+    uint64_t denseBase = 0;
+
+    // Names as unsigned keys in the same order
+    [[nodiscard]] static constexpr uint64_t internal_denseKey(const T &name);
+
+    // Slot of the name, or the empty slot where it would go in a hash table,
+    // the number of slots if there is none
+    [[nodiscard]] constexpr size_t internal_slotOf(const T &name) const;
+    [[nodiscard]] constexpr IndexType internal_find(const T &name) const;
+
+    // The name at the index must not be in the table yet
+    constexpr void internal_insertSlot(IndexType index);
+    // The name must still be in the names
+    constexpr void internal_eraseSlot(const T &name);
+    // Lays the table out again for the names, densely if the mapping allows
+    // it and the names are close enough, hashed otherwise
+    constexpr void internal_layOut();
+
+    // Widens a dense table to the key, unless it would get too sparse
+    constexpr bool internal_widenDense(uint64_t key);
+    [[nodiscard]] static constexpr size_t internal_denseLimit(size_t count);
+    constexpr void internal_rehash(size_t capacity);
+    [[nodiscard]] static constexpr size_t internal_hashCapacity(size_t count);
 };
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr bool NameIndexMap<T, IndexType>::addByName(const T &name)
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr bool NameIndexMap<T, IndexType, Mapping>::addByName(const T &name)
 {
-    if (nameToIndex
-            .try_emplace(name, static_cast<IndexType>(indexToName.size()))
-            .second)
-    {
-        indexToName.emplace_back(name);
-        return true;
-    }
-    return false;
+    if (internal_find(name) != EMPTY_SLOT)
+        return false;
+
+    assert(indexToName.size() < EMPTY_SLOT);
+    indexToName.emplace_back(name);
+    internal_insertSlot(static_cast<IndexType>(indexToName.size() - 1));
+    return true;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr size_t NameIndexMap<T, IndexType>::getSize() const
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr size_t NameIndexMap<T, IndexType, Mapping>::getSize() const
 {
     return indexToName.size();
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr bool NameIndexMap<T, IndexType>::contains(T key) const
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr bool NameIndexMap<T, IndexType, Mapping>::contains(T key) const
 {
-    return nameToIndex.contains(key);
+    return internal_find(key) != EMPTY_SLOT;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr void NameIndexMap<T, IndexType>::removeByName(T name)
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::removeByName(T name)
 {
-
-    if (!(nameToIndex.contains(name)))
+    const auto index = internal_find(name);
+    if (index == EMPTY_SLOT)
         return;
 
-    const auto index = nameToIndex.at(name);
-    indexToName.erase(indexToName.begin() + index);
-    nameToIndex.erase(name);
+    internal_eraseSlot(name);
+    const auto last = indexToName.size() - 1;
+    if (static_cast<size_t>(index) != last)
+    {
+        const auto slot = internal_slotOf(indexToName[last]);
+        slots[slot] = index;
+        indexToName[static_cast<size_t>(index)] =
+            std::move(indexToName[last]);
+    }
+    indexToName.pop_back();
+
+    // Dense tables left sparse by removals are laid out again once they span
+    // twice what they could, which spreads the cost over the removals
+    if (!hashed && slots.size() > 2 * internal_denseLimit(indexToName.size()))
+        internal_layOut();
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr void NameIndexMap<T, IndexType>::removeByIndex(IndexType index)
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::removeByIndex(
+    IndexType index)
 {
-    if (!(indexToName.size() < index))
+    if (static_cast<size_t>(index) >= indexToName.size())
         return;
 
-    const auto name = indexToName.atw(index);
-    nameToIndex.erase(name);
-    indexToName.erase(indexToName.begin() + index);
+    removeByName(indexToName[static_cast<size_t>(index)]);
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr std::vector<IndexType> NameIndexMap<T, IndexType, Mapping>::
+    removeByName(std::span<const T> names)
+{
+    std::vector<IndexType> newIndexes(indexToName.size(), 0);
+    for (const auto &name : names)
+    {
+        const auto index = internal_find(name);
+        if (index != EMPTY_SLOT)
+            newIndexes[static_cast<size_t>(index)] = REMOVED_INDEX;
+    }
+
+    size_t kept = 0;
+    for (size_t index = 0; index < indexToName.size(); index++)
+    {
+        if (newIndexes[index] == REMOVED_INDEX)
+            continue;
+        newIndexes[index] = static_cast<IndexType>(kept);
+        if (kept != index)
+            indexToName[kept] = std::move(indexToName[index]);
+        kept++;
+    }
+    if (kept != indexToName.size())
+    {
+        indexToName.resize(kept);
+        internal_layOut();
+    }
+    return newIndexes;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr T NameIndexMap<T, IndexType>::convertIndexToNodeName(
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr T NameIndexMap<T, IndexType, Mapping>::convertIndexToNodeName(
     IndexType index) const
 {
     return indexToName.at(static_cast<size_t>(index));
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr std::vector<T> NameIndexMap<T, IndexType>::convertIndexToNodeName(
-    const std::vector<IndexType> &indexes) const
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr std::vector<T> NameIndexMap<T, IndexType, Mapping>::
+    convertIndexToNodeName(const std::vector<IndexType> &indexes) const
 {
     std::vector<T> result;
     result.reserve(indexes.size());
@@ -125,67 +244,299 @@ constexpr std::vector<T> NameIndexMap<T, IndexType>::convertIndexToNodeName(
     return result;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr IndexType NameIndexMap<T, IndexType>::convertNodeNameToIndex(
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr IndexType NameIndexMap<T, IndexType, Mapping>::convertNodeNameToIndex(
     T name) const
 {
-    return nameToIndex.at(name);
+    const auto index = internal_find(name);
+    if (index == EMPTY_SLOT)
+        throw std::out_of_range("Node name not in the graph");
+    return index;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
 constexpr std::pair<IndexType, IndexType> NameIndexMap<
-    T, IndexType>::convertNodeNameToIndex(std::pair<T, T> edge) const
+    T, IndexType, Mapping>::convertNodeNameToIndex(std::pair<T, T> edge) const
 {
-    return {nameToIndex.at(edge.first), nameToIndex.at(edge.second)};
+    return {convertNodeNameToIndex(edge.first),
+            convertNodeNameToIndex(edge.second)};
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
 constexpr std::vector<IndexType> NameIndexMap<
-    T, IndexType>::convertNodeNameToIndex(std::vector<T> names) const
+    T, IndexType, Mapping>::convertNodeNameToIndex(std::vector<T> names) const
 {
     std::vector<IndexType> result;
     result.reserve(names.size());
 
     for (const auto name : names)
     {
-        result.emplace_back(nameToIndex.at(name));
+        result.emplace_back(convertNodeNameToIndex(name));
     }
     return result;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
 constexpr std::vector<std::pair<IndexType, IndexType>> NameIndexMap<
-    T, IndexType>::convertNodeNameToIndex(const std::span<std::pair<T, T>>
-                                              &edgesOfNames) const
+    T, IndexType, Mapping>::convertNodeNameToIndex(const std::span<std::pair<T,
+                                                                           T>>
+                                                       &edgesOfNames) const
 {
     std::vector<std::pair<IndexType, IndexType>> result;
     result.reserve(edgesOfNames.size());
 
-    for (const auto &[from, to] : edgesOfNames)
+    for (const auto &edge : edgesOfNames)
     {
-        result.emplace_back(nameToIndex.at(from), nameToIndex.at(to));
+        result.emplace_back(convertNodeNameToIndex(edge));
     }
     return result;
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr void NameIndexMap<T, IndexType>::reserve(size_t size)
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::reserve(size_t size)
 {
     indexToName.reserve(size);
-    nameToIndex.reserve(size);
+    if (hashed && internal_hashCapacity(size) > slots.size())
+        internal_rehash(internal_hashCapacity(size));
 }
 
-template <typename T, typename IndexType>
-    requires ValidKeyType<T>
-constexpr void NameIndexMap<T, IndexType>::shrinkToFit()
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::shrinkToFit()
 {
     indexToName.shrink_to_fit();
-    nameToIndex.rehash(0);
+    internal_layOut();
+    slots.shrink_to_fit();
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::clear()
+{
+    indexToName.clear();
+    slots.clear();
+    hashed = Mapping == FLAT_HASH;
+    shift = 64;
+    denseBase = 0;
 }
 
-} // namespace jGraph::internals
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr uint64_t NameIndexMap<T, IndexType, Mapping>::internal_denseKey(
+    const T &name)
+{
+    if constexpr (DenseKeyType<T>)
+    {
+        // Flipping the sign bit orders signed names as unsigned ones
+        constexpr auto signBit = std::is_signed_v<T>
+                                     ? uint64_t{1} << ((8 * sizeof(T)) - 1)
+                                     : 0;
+        return static_cast<uint64_t>(
+                   static_cast<std::make_unsigned_t<T>>(name)) ^
+               signBit;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr size_t NameIndexMap<T, IndexType, Mapping>::internal_slotOf(
+    const T &name) const
+{
+    if (!hashed)
+    {
+        // Names below the base wrap around past the end of the table
+        const auto offset = internal_denseKey(name) - denseBase;
+        return offset < slots.size() ? static_cast<size_t>(offset)
+                                     : slots.size();
+    }
+    if (slots.empty())
+        return 0;
+
+    const auto mask = slots.size() - 1;
+    auto slot = static_cast<size_t>(
+        (static_cast<uint64_t>(std::hash<T>{}(name)) * GOLDEN_RATIO) >> shift);
+    for (; slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask)
+    {
+        if (indexToName[static_cast<size_t>(slots[slot])] == name)
+            break;
+    }
+    return slot;
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr IndexType NameIndexMap<T, IndexType, Mapping>::internal_find(
+    const T &name) const
+{
+    const auto slot = internal_slotOf(name);
+    return slot < slots.size() ? slots[slot] : EMPTY_SLOT;
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::internal_insertSlot(
+    IndexType index)
+{
+    const auto &name = indexToName[static_cast<size_t>(index)];
+    if (!hashed)
+    {
+        if (internal_widenDense(internal_denseKey(name)))
+            slots[internal_slotOf(name)] = index;
+        else
+            internal_layOut();
+        return;
+    }
+
+    // The table is kept at most half full. Growing it lays it out again,
+    // which finds names that got dense enough since the last time.
+    if (2 * indexToName.size() > slots.size())
+        internal_layOut();
+    else
+        slots[internal_slotOf(name)] = index;
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::internal_eraseSlot(
+    const T &name)
+{
+    auto hole = internal_slotOf(name);
+    if (!hashed)
+    {
+        slots[hole] = EMPTY_SLOT;
+        return;
+    }
+
+    // Moves back every following entry of the run that the hole cuts off
+    // from its home slot
+    const auto mask = slots.size() - 1;
+    for (auto slot = (hole + 1) & mask; slots[slot] != EMPTY_SLOT;
+         slot = (slot + 1) & mask)
+    {
+        const auto &slotName = indexToName[static_cast<size_t>(slots[slot])];
+        const auto home = static_cast<size_t>(
+            (static_cast<uint64_t>(std::hash<T>{}(slotName)) * GOLDEN_RATIO) >>
+            shift);
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            slots[hole] = slots[slot];
+            hole = slot;
+        }
+    }
+    slots[hole] = EMPTY_SLOT;
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::internal_layOut()
+{
+    if (indexToName.empty())
+    {
+        slots.clear();
+        hashed = Mapping == FLAT_HASH;
+        return;
+    }
+
+    if constexpr (Mapping == DENSE_OFFSET)
+    {
+        auto low = internal_denseKey(indexToName.front());
+        auto high = low;
+        for (const auto &name : indexToName)
+        {
+            low = std::min(low, internal_denseKey(name));
+            high = std::max(high, internal_denseKey(name));
+        }
+
+        if (high - low < internal_denseLimit(indexToName.size()))
+        {
+            hashed = false;
+            denseBase = low;
+            slots.assign(static_cast<size_t>(high - low) + 1, EMPTY_SLOT);
+            for (size_t index = 0; index < indexToName.size(); index++)
+                slots[internal_slotOf(indexToName[index])] =
+                    static_cast<IndexType>(index);
+            return;
+        }
+    }
+
+    hashed = true;
+    internal_rehash(internal_hashCapacity(indexToName.size()));
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr bool NameIndexMap<T, IndexType, Mapping>::internal_widenDense(
+    uint64_t key)
+{
+    if (slots.empty())
+        denseBase = key;
+    if (key >= denseBase && key - denseBase < slots.size())
+        return true;
+
+    const auto low = std::min(key, denseBase);
+    const auto high =
+        slots.empty() ? key : std::max(key, denseBase + slots.size() - 1);
+    const auto limit = internal_denseLimit(indexToName.size());
+    if (high - low >= limit)
+        return false;
+
+    // Growing downwards leaves as many free slots below as the table had,
+    // so that names coming in decreasing order are amortized constant time
+    if (low < denseBase)
+    {
+        const auto span = static_cast<size_t>(high - low) + 1;
+        const auto slack =
+            std::min<uint64_t>({slots.size(), low, limit - span});
+        const auto newBase = low - slack;
+        slots.insert(slots.begin(),
+                     static_cast<size_t>(denseBase - newBase), EMPTY_SLOT);
+        denseBase = newBase;
+    }
+    slots.resize(static_cast<size_t>(high - denseBase) + 1, EMPTY_SLOT);
+    return true;
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr size_t NameIndexMap<T, IndexType, Mapping>::internal_denseLimit(
+    size_t count)
+{
+    return std::max(DENSE_SPREAD * count, MIN_DENSE_SPAN);
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr void NameIndexMap<T, IndexType, Mapping>::internal_rehash(
+    size_t capacity)
+{
+    assert(std::has_single_bit(capacity));
+    slots.assign(capacity, EMPTY_SLOT);
+    shift = 64U - static_cast<unsigned>(std::countr_zero(capacity));
+    for (size_t index = 0; index < indexToName.size(); index++)
+        slots[internal_slotOf(indexToName[index])] =
+            static_cast<IndexType>(index);
+}
+
+template <typename T, typename IndexType, NameMapping Mapping>
+    requires ValidKeyType<T> && (Mapping == FLAT_HASH || DenseKeyType<T>)
+constexpr size_t NameIndexMap<T, IndexType, Mapping>::internal_hashCapacity(
+    size_t count)
+{
+    auto capacity = MIN_CAPACITY;
+    while (capacity < 2 * count)
+        capacity *= 2;
+    return capacity;
+}
+
+} // namespace internals
+
+} // namespace jGraph
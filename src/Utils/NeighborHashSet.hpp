@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+// Open addressing set of node indexes, for the neighbors of high degree
+// nodes. Slots are probed linearly from a Fibonacci hash of the index and
+// the table is kept at most half full, so lookups touch one or two cache
+// lines on average. Erasing shifts the following entries back instead of
+// leaving tombstones. The largest value of IndexType marks empty slots and
+// cannot be stored.
+template <typename IndexType>
+class NeighborHashSet
+{
+  public:
+    constexpr NeighborHashSet() = default;
+    constexpr explicit NeighborHashSet(std::span<const IndexType> values);
+
+    [[nodiscard]] constexpr bool contains(IndexType value) const;
+    constexpr bool insert(IndexType value);
+    constexpr bool erase(IndexType value);
+
+    [[nodiscard]] constexpr size_t size() const;
+    [[nodiscard]] constexpr bool empty() const;
+
+  private:
+    static constexpr IndexType EMPTY_SLOT =
+        std::numeric_limits<IndexType>::max();
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr uint64_t GOLDEN_RATIO = 0x9e3779b97f4a7c15U;
+
+    std::vector<IndexType> slots;
+    size_t count = 0;
+    unsigned shift = 64;
+
+    [[nodiscard]] constexpr size_t internal_slotOf(IndexType value) const;
+    constexpr void internal_rehash(size_t capacity);
+};
+
+template <typename IndexType>
+constexpr NeighborHashSet<IndexType>::NeighborHashSet(
+    std::span<const IndexType> values)
+{
+    auto capacity = MIN_CAPACITY;
+    while (capacity < 2 * values.size())
+        capacity *= 2;
+    internal_rehash(capacity);
+
+    for (const auto value : values)
+        insert(value);
+}
+
+template <typename IndexType>
+constexpr size_t NeighborHashSet<IndexType>::internal_slotOf(
+    IndexType value) const
+{
+    return static_cast<size_t>(
+        (static_cast<uint64_t>(value) * GOLDEN_RATIO) >> shift);
+}
+
+template <typename IndexType>
+constexpr bool NeighborHashSet<IndexType>::contains(IndexType value) const
+{
+    if (slots.empty())
+        return false;
+
+    const auto mask = slots.size() - 1;
+    for (auto slot = internal_slotOf(value);; slot = (slot + 1) & mask)
+    {
+        if (slots[slot] == value)
+            return true;
+        if (slots[slot] == EMPTY_SLOT)
+            return false;
+    }
+}
+
+template <typename IndexType>
+constexpr bool NeighborHashSet<IndexType>::insert(IndexType value)
+{
+    assert(value != EMPTY_SLOT);
+    if (2 * (count + 1) > slots.size())
+        internal_rehash(std::max(MIN_CAPACITY, 2 * slots.size()));
+
+    const auto mask = slots.size() - 1;
+    auto slot = internal_slotOf(value);
+    for (; slots[slot] != EMPTY_SLOT; slot = (slot + 1) & mask)
+    {
+        if (slots[slot] == value)
+            return false;
+    }
+    slots[slot] = value;
+    count++;
+    return true;
+}
+
+template <typename IndexType>
+constexpr bool NeighborHashSet<IndexType>::erase(IndexType value)
+{
+    if (slots.empty())
+        return false;
+
+    const auto mask = slots.size() - 1;
+    auto hole = internal_slotOf(value);
+    for (; slots[hole] != value; hole = (hole + 1) & mask)
+    {
+        if (slots[hole] == EMPTY_SLOT)
+            return false;
+    }
+
+    // Moves back every following entry of the run that the hole cuts off
+    // from its home slot
+    for (auto slot = (hole + 1) & mask; slots[slot] != EMPTY_SLOT;
+         slot = (slot + 1) & mask)
+    {
+        const auto home = internal_slotOf(slots[slot]);
+        if (((slot - home) & mask) >= ((slot - hole) & mask))
+        {
+            slots[hole] = slots[slot];
+            hole = slot;
+        }
+    }
+    slots[hole] = EMPTY_SLOT;
+    count--;
+    return true;
+}
+
+template <typename IndexType>
+constexpr size_t NeighborHashSet<IndexType>::size() const
+{
+    return count;
+}
+
+template <typename IndexType>
+constexpr bool NeighborHashSet<IndexType>::empty() const
+{
+    return count == 0;
+}
+
+template <typename IndexType>
+constexpr void NeighborHashSet<IndexType>::internal_rehash(size_t capacity)
+{
+    assert(std::has_single_bit(capacity));
+    auto oldSlots = std::move(slots);
+    slots.assign(capacity, EMPTY_SLOT);
+    shift = 64U - static_cast<unsigned>(std::countr_zero(capacity));
+    count = 0;
+
+    for (const auto value : oldSlots)
+    {
+        if (value != EMPTY_SLOT)
+            insert(value);
+    }
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace jGraph::internals
+{
+
+[[nodiscard]] inline size_t numberOfWorkers(size_t numberOfTasks)
+{
+    const size_t hardwareThreads =
+        std::max<size_t>(1, std::thread::hardware_concurrency());
+    return std::max<size_t>(1, std::min(hardwareThreads, numberOfTasks));
+}
+
+// Calls function(workerIndex, taskIndex) for every task in
+// [0, numberOfTasks). Tasks are handed out in chunks through a shared
+// counter, so workerIndex can be used to address per-thread scratch buffers
+// sized with numberOfWorkers(numberOfTasks).
+template <typename Function>
+void parallelFor(size_t numberOfTasks, Function &&function,
+                 size_t chunkSize = 1)
+{
+    const auto workers = numberOfWorkers(numberOfTasks);
+    if (workers <= 1)
+    {
+        for (size_t task = 0; task < numberOfTasks; task++)
+        {
+            function(size_t{0}, task);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextTask = 0;
+    std::vector<std::exception_ptr> errors(workers);
+
+    auto work = [&](size_t worker) {
+        try
+        {
+            for (size_t begin = nextTask.fetch_add(chunkSize);
+                 begin < numberOfTasks; begin = nextTask.fetch_add(chunkSize))
+            {
+                const auto end = std::min(numberOfTasks, begin + chunkSize);
+                for (size_t task = begin; task < end; task++)
+                {
+                    function(worker, task);
+                }
+            }
+        }
+        catch (...)
+        {
+            errors[worker] = std::current_exception();
+            nextTask = numberOfTasks;
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(workers - 1);
+        for (size_t worker = 1; worker < workers; worker++)
+        {
+            threads.emplace_back(work, worker);
+        }
+        work(0);
+    }
+
+    for (const auto &error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+// Sorts equal slices of the range in parallel, then merges neighbouring
+// slices pairwise, every round of merges also running in parallel
+template <std::random_access_iterator Iterator, typename Compare = std::less<>>
+void parallelSort(Iterator first, Iterator last, Compare compare = {})
+{
+    constexpr size_t minimumSliceSize = size_t{1} << 14U;
+    const auto size = static_cast<size_t>(std::distance(first, last));
+    const auto slices = numberOfWorkers(size / minimumSliceSize);
+    if (slices <= 1)
+    {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    std::vector<Iterator> bounds;
+    bounds.reserve(slices + 1);
+    for (size_t slice = 0; slice <= slices; slice++)
+    {
+        bounds.emplace_back(
+            first + static_cast<std::ptrdiff_t>(size * slice / slices));
+    }
+
+    parallelFor(slices, [&](size_t, size_t slice) {
+        std::sort(bounds[slice], bounds[slice + 1], compare);
+    });
+
+    for (size_t width = 1; width < slices; width *= 2)
+    {
+        const auto merges = (slices + (2 * width) - 1) / (2 * width);
+        parallelFor(merges, [&](size_t, size_t merge) {
+            const auto begin = merge * 2 * width;
+            const auto middle = std::min(begin + width, slices);
+            const auto end = std::min(begin + (2 * width), slices);
+            if (middle < end)
+            {
+                std::inplace_merge(bounds[begin], bounds[middle], bounds[end],
+                                   compare);
+            }
+        });
+    }
+}
+
+// Stable least significant digit radix sort on the lowest keyBits bits of
+// key(record), a byte per pass. Every pass counts the digits of equal slices
+// of the range in parallel, then moves every slice in parallel from its own
+// offsets, so that records never change slices within a pass. Passes over a
+// digit shared by every record are skipped.
+template <typename Record, typename Key>
+void parallelRadixSort(std::vector<Record> &records, unsigned keyBits, Key key)
+{
+    constexpr unsigned digitBits = 8;
+    constexpr size_t radix = size_t{1} << digitBits;
+    constexpr size_t minimumSliceSize = size_t{1} << 14U;
+    const auto size = records.size();
+    const auto slices = numberOfWorkers(size / minimumSliceSize);
+    const auto sliceBegin = [&](size_t slice) { return size * slice / slices; };
+
+    std::vector<Record> buffer(size);
+    std::vector<std::array<size_t, radix>> offsets(slices);
+    for (unsigned shift = 0; shift < keyBits; shift += digitBits)
+    {
+        const auto digitOf = [&](const Record &record) {
+            return static_cast<size_t>((static_cast<uint64_t>(key(record)) >>
+                                        shift) &
+                                       (radix - 1));
+        };
+
+        parallelFor(slices, [&](size_t, size_t slice) {
+            offsets[slice].fill(0);
+            for (auto i = sliceBegin(slice); i < sliceBegin(slice + 1); i++)
+                offsets[slice][digitOf(records[i])]++;
+        });
+
+        size_t total = 0;
+        bool sharedDigit = false;
+        for (size_t digit = 0; digit < radix; digit++)
+        {
+            const auto digitStart = total;
+            for (auto &sliceOffsets : offsets)
+            {
+                const auto count = sliceOffsets[digit];
+                sliceOffsets[digit] = total;
+                total += count;
+            }
+            sharedDigit = sharedDigit || total - digitStart == size;
+        }
+        if (sharedDigit)
+            continue;
+
+        parallelFor(slices, [&](size_t, size_t slice) {
+            auto &sliceOffsets = offsets[slice];
+            for (auto i = sliceBegin(slice); i < sliceBegin(slice + 1); i++)
+            {
+                buffer[sliceOffsets[digitOf(records[i])]++] =
+                    std::move(records[i]);
+            }
+        });
+        records.swap(buffer);
+    }
+}
+
+} // namespace jGraph::internals
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace jGraph::internals
+{
+
+// Above this size ratio, intersections binary search the elements of the
+// shorter range in the longer one instead of merging both
+inline constexpr size_t GALLOPING_RATIO = 32;
+
+// Number of values of both sorted ranges without repetitions. Merges
+// advance both ranges with comparisons turned into increments instead of
+// branches, leaving only the loop condition to predict, and very unbalanced
+// ranges are searched instead.
+template <typename ValueType>
+[[nodiscard]] constexpr size_t intersectionSize(
+    std::span<const ValueType> first, std::span<const ValueType> second)
+{
+    size_t result = 0;
+    if (first.size() > second.size())
+        std::swap(first, second);
+
+    if (first.size() * GALLOPING_RATIO < second.size())
+    {
+        auto position = second.begin();
+        for (const auto value : first)
+        {
+            position = std::lower_bound(position, second.end(), value);
+            if (position == second.end())
+                break;
+            result += static_cast<size_t>(*position == value);
+        }
+        return result;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < first.size() && j < second.size())
+    {
+        const auto left = first[i];
+        const auto right = second[j];
+        result += static_cast<size_t>(left == right);
+        i += static_cast<size_t>(left <= right);
+        j += static_cast<size_t>(right <= left);
+    }
+    return result;
+}
+
+// Sum of valueWeights[value] over the values of both sorted ranges without
+// repetitions
+template <typename ValueType>
+[[nodiscard]] constexpr double weightedIntersection(
+    std::span<const ValueType> first, std::span<const ValueType> second,
+    std::span<const double> valueWeights)
+{
+    double result = 0;
+    if (first.size() > second.size())
+        std::swap(first, second);
+
+    if (first.size() * GALLOPING_RATIO < second.size())
+    {
+        auto position = second.begin();
+        for (const auto value : first)
+        {
+            position = std::lower_bound(position, second.end(), value);
+            if (position == second.end())
+                break;
+            if (*position == value)
+                result += valueWeights[static_cast<size_t>(value)];
+        }
+        return result;
+    }
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < first.size() && j < second.size())
+    {
+        const auto left = first[i];
+        const auto right = second[j];
+        result += left == right ? valueWeights[static_cast<size_t>(left)] : 0;
+        i += static_cast<size_t>(left <= right);
+        j += static_cast<size_t>(right <= left);
+    }
+    return result;
+}
+
+} // namespace jGraph::internals
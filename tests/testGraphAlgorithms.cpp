@@ -1,11 +1,18 @@
+#include "DirectedListGraph.hpp"
 #include "ListGraph.hpp"
 #include "MatrixGraph.hpp"
+#include "WeightedListGraph.hpp"
 
 #include "gtest/gtest.h"
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -76,3 +83,755 @@ TYPED_TEST(GraphAlgorithmsTests, connectedComponents)
         ASSERT_TRUE(it != components.end());
     }
 }
+
+TYPED_TEST(GraphAlgorithmsTests, minimumSpanningForest)
+{
+    const std::array<std::pair<const unsigned, const unsigned>, 5> edges{
+        {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {4, 5}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addNode(6);
+
+    for (const auto algorithm : {jGraph::KRUSKAL, jGraph::PRIM,
+                                 jGraph::BORUVKA})
+    {
+        const auto forest = this->graph.minimumSpanningForest(algorithm);
+        ASSERT_EQ(forest.size(), this->graph.getNumberOfNodes() -
+                                     this->graph.components().size());
+        for (const auto &[from, to, weight] : forest)
+        {
+            ASSERT_TRUE(this->graph.hasEdge({from, to}));
+            ASSERT_EQ(weight, 1);
+        }
+    }
+}
+
+TYPED_TEST(GraphAlgorithmsTests, maximumFlow)
+{
+    // Two edge disjoint paths from 0 to 5, joined by a bridge 5-6
+    const std::array<std::pair<const unsigned, const unsigned>, 8> edges{
+        {{0, 1}, {1, 2}, {2, 5}, {0, 3}, {3, 4}, {4, 5}, {1, 4}, {5, 6}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    for (const auto algorithm : {jGraph::PUSH_RELABEL, jGraph::DINIC})
+    {
+        ASSERT_EQ(this->graph.maximumFlow({0, 5}, algorithm).value, 2);
+
+        const auto cut = this->graph.maximumFlow({0, 6}, algorithm);
+        ASSERT_EQ(cut.value, 1);
+        ASSERT_EQ(cut.sinkSide.size(), 1);
+        ASSERT_EQ(cut.sinkSide.front(), 6);
+    }
+}
+
+TYPED_TEST(GraphAlgorithmsTests, globalMinimumCut)
+{
+    // Triangles 0-1-2 and 3-4-5 joined by the edge 2-3
+    const std::array<std::pair<const unsigned, const unsigned>, 7> edges{
+        {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    for (const auto algorithm : {jGraph::STOER_WAGNER, jGraph::KARGER_STEIN})
+    {
+        const auto cut = this->graph.globalMinimumCut(algorithm);
+        ASSERT_EQ(cut.weight, 1);
+        ASSERT_EQ(cut.firstSide.size(), 3);
+        ASSERT_EQ(cut.secondSide.size(), 3);
+        ASSERT_TRUE(std::ranges::contains(cut.firstSide, 2) !=
+                    std::ranges::contains(cut.firstSide, 3));
+    }
+
+    this->graph.addNode(6);
+    const auto cut = this->graph.globalMinimumCut();
+    ASSERT_EQ(cut.weight, 0);
+    ASSERT_EQ(cut.firstSide.size() + cut.secondSide.size(), 7);
+}
+
+TYPED_TEST(GraphAlgorithmsTests, randomWalks)
+{
+    const std::array<std::pair<const unsigned, const unsigned>, 4> edges{
+        {{0, 1}, {1, 2}, {2, 3}, {3, 1}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    jGraph::randomWalkParameters parameters;
+    parameters.walkLength = 6;
+    parameters.walksPerNode = 3;
+    for (const auto returnParameter : {1.0, 0.25})
+    {
+        parameters.returnParameter = returnParameter;
+        parameters.inOutParameter = 1 / returnParameter;
+        const auto walks = this->graph.randomWalks(parameters);
+        ASSERT_EQ(this->graph.numberOfRandomWalks(parameters), 12);
+        ASSERT_EQ(walks.size(), 72);
+        ASSERT_EQ(walks, this->graph.randomWalks(parameters));
+
+        for (size_t walk = 0; walk < 12; walk++)
+        {
+            for (size_t step = 1; step < 6; step++)
+            {
+                ASSERT_TRUE(this->graph.hasEdge(
+                    {walks[(walk * 6) + step - 1], walks[(walk * 6) + step]}));
+            }
+        }
+    }
+
+    std::atomic<size_t> numberOfWalks = 0;
+    this->graph.forEachRandomWalk(
+        [&](auto walk) {
+            ASSERT_EQ(walk.size(), 6);
+            numberOfWalks++;
+        },
+        parameters);
+    ASSERT_EQ(numberOfWalks, 12);
+}
+
+TYPED_TEST(GraphAlgorithmsTests, biconnectivity)
+{
+    // Triangles 0-1-2 and 3-4-5 joined by the bridge 2-3, with 6 hanging
+    // from 5 and 7 isolated
+    const std::array<std::pair<const unsigned, const unsigned>, 8> edges{
+        {{0, 1}, {1, 2}, {2, 0}, {2, 3}, {3, 4}, {4, 5}, {5, 3}, {5, 6}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addNode(7);
+
+    ASSERT_TRUE(std::ranges::is_permutation(this->graph.articulationPoints(),
+                                            std::vector<unsigned>{2, 3, 5}));
+
+    const auto bridges = this->graph.bridges();
+    ASSERT_EQ(bridges.size(), 2);
+    for (const auto &[from, to] : bridges)
+    {
+        ASSERT_TRUE((std::min(from, to) == 2 && std::max(from, to) == 3) ||
+                    (std::min(from, to) == 5 && std::max(from, to) == 6));
+    }
+
+    const std::vector<std::vector<unsigned>> expectedComponents{
+        {0, 1, 2}, {2, 3}, {3, 4, 5}, {5, 6}};
+    const auto components = this->graph.biconnectedComponents();
+    ASSERT_EQ(components.size(), expectedComponents.size());
+    for (const auto &expectedComponent : expectedComponents)
+    {
+        ASSERT_TRUE(std::ranges::any_of(components, [&](const auto &vec) {
+            return std::ranges::is_permutation(vec, expectedComponent);
+        }));
+    }
+}
+
+TYPED_TEST(GraphAlgorithmsTests, bipartiteMatching)
+{
+    // Workers 0 to 4 against tasks 10 to 13, so one worker stays idle
+    const std::array<std::pair<const unsigned, const unsigned>, 7> edges{
+        {{0, 10}, {0, 11}, {1, 11}, {1, 12}, {2, 12}, {2, 13}, {3, 10}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addEdge({4, 13});
+
+    ASSERT_TRUE(this->graph.isBipartite());
+    const auto sides = this->graph.bipartition();
+    ASSERT_TRUE(sides.has_value());
+    for (const auto &[from, to] : edges)
+    {
+        ASSERT_NE(std::ranges::contains(sides->first, from),
+                  std::ranges::contains(sides->first, to));
+    }
+
+    for (const auto algorithm :
+         {jGraph::HOPCROFT_KARP, jGraph::PARALLEL_PUSH_RELABEL})
+    {
+        const auto matching = this->graph.maximumMatching(algorithm);
+        ASSERT_EQ(matching.size(), 4);
+
+        std::vector<unsigned> matchedNodes;
+        for (const auto &[first, second] : matching)
+        {
+            ASSERT_TRUE(this->graph.hasEdge({first, second}));
+            ASSERT_TRUE(std::ranges::contains(sides->first, first));
+            matchedNodes.emplace_back(first);
+            matchedNodes.emplace_back(second);
+        }
+        std::ranges::sort(matchedNodes);
+        ASSERT_TRUE(std::ranges::adjacent_find(matchedNodes) ==
+                    matchedNodes.end());
+    }
+
+    this->graph.addEdge({10, 11});
+    ASSERT_FALSE(this->graph.isBipartite());
+    ASSERT_FALSE(this->graph.bipartition().has_value());
+    ASSERT_TRUE(this->graph.maximumMatching().empty());
+}
+
+TYPED_TEST(GraphAlgorithmsTests, coloringAndIndependentSet)
+{
+    // A wheel: the hub 0 and an odd cycle need four colors
+    const std::array<std::pair<const unsigned, const unsigned>, 10> edges{
+        {{0, 1},
+         {0, 2},
+         {0, 3},
+         {0, 4},
+         {0, 5},
+         {1, 2},
+         {2, 3},
+         {3, 4},
+         {4, 5},
+         {5, 1}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addNode(6);
+
+    for (const auto order :
+         {jGraph::LARGEST_DEGREE_FIRST, jGraph::SMALLEST_LAST})
+    {
+        const auto coloring = this->graph.greedyColoring(order);
+        ASSERT_EQ(coloring.size(), 7);
+
+        std::vector<size_t> colors(7);
+        for (const auto &[node, color] : coloring)
+            colors[static_cast<size_t>(node)] = color;
+        for (const auto &[from, to] : edges)
+            ASSERT_NE(colors[from], colors[to]);
+        ASSERT_EQ(std::ranges::max(colors), 3);
+    }
+
+    for (const uint64_t seed : {0U, 1U, 2U})
+    {
+        const auto independentSet = this->graph.maximalIndependentSet(seed);
+        ASSERT_TRUE(std::ranges::contains(independentSet, 6));
+        for (const auto &[from, to] : edges)
+        {
+            ASSERT_FALSE(std::ranges::contains(independentSet, from) &&
+                         std::ranges::contains(independentSet, to));
+        }
+        for (unsigned node = 0; node < 6; node++)
+        {
+            ASSERT_TRUE(std::ranges::contains(independentSet, node) ||
+                        std::ranges::any_of(independentSet, [&](auto other) {
+                            return this->graph.hasEdge({node, other});
+                        }));
+        }
+    }
+}
+
+TYPED_TEST(GraphAlgorithmsTests, communities)
+{
+    // Two cliques of four nodes, joined by the edge 3-4
+    const std::array<std::pair<const unsigned, const unsigned>, 13> edges{
+        {{0, 1},
+         {0, 2},
+         {0, 3},
+         {1, 2},
+         {1, 3},
+         {2, 3},
+         {4, 5},
+         {4, 6},
+         {4, 7},
+         {5, 6},
+         {5, 7},
+         {6, 7},
+         {3, 4}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    const auto communityOf = [](const auto &result, unsigned node) {
+        return std::ranges::find(result.communities, node,
+                                 [](const auto &pair) { return pair.first; })
+            ->second;
+    };
+    const auto assertCliquesFound = [&](const auto &result,
+                                        double modularity) {
+        for (unsigned node = 1; node < 4; node++)
+        {
+            ASSERT_EQ(communityOf(result, node), communityOf(result, 0));
+            ASSERT_EQ(communityOf(result, node + 4), communityOf(result, 4));
+        }
+        ASSERT_NE(communityOf(result, 0), communityOf(result, 4));
+        ASSERT_NEAR(result.modularity, modularity, 1e-9);
+    };
+
+    assertCliquesFound(this->graph.louvain(), (12.0 / 13) - 0.5);
+    this->graph.removeEdge({3, 4});
+    assertCliquesFound(this->graph.louvain(), 0.5);
+    assertCliquesFound(this->graph.labelPropagation(jGraph::DEGREE_ORDER), 0.5);
+    assertCliquesFound(this->graph.labelPropagation(jGraph::RANDOM_ORDER, 7),
+                       0.5);
+}
+
+TYPED_TEST(GraphAlgorithmsTests, maximalCliques)
+{
+    // The clique 0-1-2-3, the triangle 3-4-5, the edge 5-6 and the isolated
+    // node 7
+    const std::array<std::pair<const unsigned, const unsigned>, 10> edges{
+        {{0, 1},
+         {0, 2},
+         {0, 3},
+         {1, 2},
+         {1, 3},
+         {2, 3},
+         {3, 4},
+         {3, 5},
+         {4, 5},
+         {5, 6}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addNode(7);
+
+    using NodeType = decltype(this->graph.getNodes())::value_type;
+    auto cliques = this->graph.maximalCliques();
+    for (auto &clique : cliques)
+        std::ranges::sort(clique);
+    std::ranges::sort(cliques);
+    ASSERT_EQ(cliques, (std::vector<std::vector<NodeType>>{
+                           {0, 1, 2, 3}, {3, 4, 5}, {5, 6}, {7}}));
+
+    std::atomic<size_t> numberOfCliques = 0;
+    std::atomic<size_t> totalSize = 0;
+    this->graph.forEachMaximalClique([&](auto clique) {
+        numberOfCliques++;
+        totalSize += clique.size();
+    });
+    ASSERT_EQ(numberOfCliques, 4);
+    ASSERT_EQ(totalSize, 10);
+}
+
+TYPED_TEST(GraphAlgorithmsTests, subgraphEmbeddings)
+{
+    // A square with the diagonal 0-2, and a pendant node 4
+    const std::array<std::pair<const unsigned, const unsigned>, 6> edges{
+        {{0, 1}, {1, 2}, {2, 3}, {3, 0}, {0, 2}, {3, 4}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    jGraph::ListGraph<unsigned> triangle;
+    triangle.addEdge({0, 1});
+    triangle.addEdge({1, 2});
+    triangle.addEdge({2, 0});
+
+    jGraph::ListGraph<unsigned> square;
+    square.addEdge({0, 1});
+    square.addEdge({1, 2});
+    square.addEdge({2, 3});
+    square.addEdge({3, 0});
+
+    // Every subgraph is found once per automorphism of the pattern
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(triangle), 12);
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(triangle, true), 12);
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(square), 8);
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(square, true), 0);
+
+    const auto squareNodes = square.getNodes();
+    const auto embeddings = this->graph.subgraphEmbeddings(square);
+    ASSERT_EQ(embeddings.size(), 8);
+    for (const auto &embedding : embeddings)
+    {
+        ASSERT_EQ(embedding.size(), 4);
+        for (size_t first = 0; first < 4; first++)
+        {
+            for (size_t second = 0; second < 4; second++)
+            {
+                if (square.hasEdge({squareNodes[first], squareNodes[second]}))
+                {
+                    ASSERT_TRUE(this->graph.hasEdge(
+                        {embedding[first], embedding[second]}));
+                }
+            }
+        }
+        ASSERT_FALSE(std::ranges::contains(embedding, 4));
+    }
+
+    this->graph.removeEdge({0, 2});
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(triangle), 0);
+    ASSERT_EQ(this->graph.countSubgraphEmbeddings(square, true), 8);
+}
+
+TYPED_TEST(GraphAlgorithmsTests, kShortestPaths)
+{
+    const std::array<std::pair<const unsigned, const unsigned>, 4> edges{
+        {{0, 1}, {1, 2}, {2, 3}, {3, 0}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+
+    const auto paths = this->graph.kShortestPaths({0, 2}, 5);
+    ASSERT_EQ(paths.size(), 2);
+    for (const auto &path : paths)
+    {
+        ASSERT_EQ(path.length, 2);
+        ASSERT_EQ(path.nodes.size(), 3);
+        ASSERT_EQ(path.nodes.front(), 0);
+        ASSERT_EQ(path.nodes.back(), 2);
+    }
+    ASSERT_NE(paths[0].nodes, paths[1].nodes);
+
+    auto generator = this->graph.shortestPaths({1, 1});
+    ASSERT_EQ(generator.next().value().nodes.size(), 1);
+    ASSERT_FALSE(generator.next().has_value());
+}
+
+TYPED_TEST(GraphAlgorithmsTests, allPairsShortestPaths)
+{
+    const std::array<std::pair<const unsigned, const unsigned>, 3> edges{
+        {{0, 1}, {1, 2}, {2, 3}}};
+
+    for (const auto &edge : edges)
+    {
+        this->graph.addEdge(edge);
+    }
+    this->graph.addNode(4);
+
+    for (const auto algorithm : {jGraph::FLOYD_WARSHALL, jGraph::JOHNSON})
+    {
+        const auto result = this->graph.allPairsShortestPaths(algorithm, true);
+        ASSERT_FALSE(result.hasNegativeCycle);
+        ASSERT_EQ(result.nodes.size(), 5);
+        ASSERT_EQ(result.distances.size(), 25);
+
+        const auto position = [&](unsigned node) {
+            return static_cast<size_t>(std::ranges::find(result.nodes, node) -
+                                       result.nodes.begin());
+        };
+        for (unsigned from = 0; from < 4; from++)
+        {
+            for (unsigned to = 0; to < 4; to++)
+            {
+                const auto distance =
+                    result.distances[(position(from) * 5) + position(to)];
+                ASSERT_EQ(distance, from > to ? from - to : to - from);
+            }
+            ASSERT_EQ(result.distances[(position(from) * 5) + position(4)],
+                      std::numeric_limits<double>::infinity());
+        }
+
+        const auto path = result.getPath(position(3), position(0));
+        ASSERT_EQ(path.size(), 4);
+        ASSERT_EQ(path.front(), 3);
+        ASSERT_EQ(path[1], 2);
+        ASSERT_EQ(path.back(), 0);
+        ASSERT_TRUE(result.getPath(position(0), position(4)).empty());
+    }
+}
+
+TEST(DirectedGraphAlgorithmsTests, allPairsShortestPaths)
+{
+    jGraph::DirectedListGraph<unsigned> graph;
+    graph.addEdge({0, 1});
+    graph.addEdge({1, 2});
+    graph.addEdge({2, 0});
+
+    for (const auto algorithm : {jGraph::FLOYD_WARSHALL, jGraph::JOHNSON})
+    {
+        const auto result = graph.allPairsShortestPaths(algorithm, true);
+        const auto &nodes = result.nodes;
+        const auto position = [&](unsigned node) {
+            return static_cast<size_t>(std::ranges::find(nodes, node) -
+                                       nodes.begin());
+        };
+        ASSERT_EQ(result.distances[(position(0) * 3) + position(2)], 2);
+        ASSERT_EQ(result.distances[(position(2) * 3) + position(0)], 1);
+        ASSERT_EQ(result.getPath(position(1), position(0)),
+                  (std::vector<unsigned>{1, 2, 0}));
+    }
+}
+
+TEST(DirectedGraphAlgorithmsTests, randomWalks)
+{
+    jGraph::DirectedListGraph<unsigned> graph;
+    graph.addEdge({0, 1});
+    graph.addEdge({1, 2});
+
+    jGraph::randomWalkParameters parameters;
+    parameters.walkLength = 4;
+    parameters.walksPerNode = 1;
+    ASSERT_EQ(graph.randomWalks(parameters),
+              (std::vector<unsigned>{0, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 2}));
+
+    std::atomic<size_t> numberOfNodes = 0;
+    graph.forEachRandomWalk(
+        [&](std::span<const unsigned> walk) {
+            ASSERT_EQ(walk.back(), 2);
+            numberOfNodes += walk.size();
+        },
+        parameters);
+    ASSERT_EQ(numberOfNodes, 6);
+}
+
+TEST(DirectedGraphAlgorithmsTests, maximumFlow)
+{
+    jGraph::DirectedListGraph<unsigned> graph;
+    graph.addEdge({0, 1});
+    graph.addEdge({0, 2});
+    graph.addEdge({1, 3});
+    graph.addEdge({2, 3});
+    graph.addEdge({3, 0});
+
+    for (const auto algorithm : {jGraph::PUSH_RELABEL, jGraph::DINIC})
+    {
+        ASSERT_EQ(graph.maximumFlow({0, 3}, algorithm).value, 2);
+        ASSERT_EQ(graph.maximumFlow({3, 1}, algorithm).value, 1);
+    }
+}
+
+TEST(WeightedGraphAlgorithmsTests, globalMinimumCut)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 10);
+    graph.addWeightedEdge({0, 2}, 5);
+    graph.addWeightedEdge({1, 2}, 15);
+    graph.addWeightedEdge({1, 3}, 4);
+    graph.addWeightedEdge({2, 3}, 8);
+    graph.addWeightedEdge({3, 4}, 20);
+
+    for (const auto algorithm : {jGraph::STOER_WAGNER, jGraph::KARGER_STEIN})
+    {
+        const auto cut = graph.globalMinimumCut(algorithm, 0, 42);
+        ASSERT_EQ(cut.weight, 12);
+        ASSERT_TRUE(std::ranges::is_permutation(
+                        cut.firstSide, std::vector<unsigned>{3, 4}) ||
+                    std::ranges::is_permutation(
+                        cut.secondSide, std::vector<unsigned>{3, 4}));
+    }
+}
+
+TEST(WeightedGraphAlgorithmsTests, randomWalks)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 0);
+    graph.addWeightedEdge({2, 3}, 1);
+
+    jGraph::randomWalkParameters parameters;
+    parameters.walkLength = 5;
+    const auto walks = graph.randomWalks(parameters);
+    for (size_t step = 1; step < walks.size(); step++)
+    {
+        if (step % 5 != 0)
+        {
+            ASSERT_TRUE((walks[step - 1] < 2) == (walks[step] < 2));
+        }
+    }
+
+    parameters.weighted = false;
+    ASSERT_TRUE(std::ranges::contains(graph.randomWalks(parameters), 3));
+}
+
+TEST(WeightedGraphAlgorithmsTests, maximumFlow)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 10);
+    graph.addWeightedEdge({0, 2}, 5);
+    graph.addWeightedEdge({1, 2}, 15);
+    graph.addWeightedEdge({1, 3}, 4);
+    graph.addWeightedEdge({2, 3}, 8);
+    graph.addWeightedEdge({3, 4}, 20);
+
+    for (const auto algorithm : {jGraph::PUSH_RELABEL, jGraph::DINIC})
+    {
+        const auto result = graph.maximumFlow({0, 4}, algorithm);
+        ASSERT_EQ(result.value, 12);
+        ASSERT_TRUE(std::ranges::is_permutation(
+            result.sinkSide, std::vector<unsigned>{4}) ||
+                    std::ranges::is_permutation(result.sinkSide,
+                                                std::vector<unsigned>{3, 4}));
+
+        // Flow is conserved everywhere but at the source and the sink
+        std::array<double, 5> balance{};
+        for (const auto &[from, to, flow] : result.edgeFlows)
+        {
+            ASSERT_LE(flow, graph.getWeight({from, to}).value());
+            balance[from] -= flow;
+            balance[to] += flow;
+        }
+        ASSERT_EQ(balance[0], -12);
+        ASSERT_EQ(balance[1], 0);
+        ASSERT_EQ(balance[2], 0);
+        ASSERT_EQ(balance[3], 0);
+        ASSERT_EQ(balance[4], 12);
+    }
+}
+
+TEST(WeightedGraphAlgorithmsTests, minimumSpanningForest)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 4);
+    graph.addWeightedEdge({0, 2}, 1);
+    graph.addWeightedEdge({1, 2}, 2);
+    graph.addWeightedEdge({1, 3}, 5);
+    graph.addWeightedEdge({2, 3}, 8);
+    graph.addWeightedEdge({3, 4}, 3);
+    graph.addWeightedEdge({2, 4}, 9);
+
+    using EdgeType = std::tuple<unsigned, unsigned, double>;
+    for (const auto algorithm : {jGraph::KRUSKAL, jGraph::PRIM,
+                                 jGraph::BORUVKA})
+    {
+        const auto forest = graph.minimumSpanningForest(algorithm);
+        ASSERT_EQ(forest.size(), 4);
+
+        double totalWeight = 0;
+        for (const auto &edge : forest)
+            totalWeight += std::get<2>(edge);
+        ASSERT_EQ(totalWeight, 11);
+        ASSERT_TRUE(std::ranges::contains(forest, EdgeType{3, 4, 3}));
+    }
+}
+
+TEST(WeightedGraphAlgorithmsTests, kShortestPaths)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 3);
+    graph.addWeightedEdge({0, 2}, 2);
+    graph.addWeightedEdge({1, 3}, 4);
+    graph.addWeightedEdge({2, 1}, 1);
+    graph.addWeightedEdge({2, 3}, 2);
+    graph.addWeightedEdge({2, 4}, 3);
+    graph.addWeightedEdge({3, 4}, 2);
+    graph.addWeightedEdge({3, 5}, 1);
+    graph.addWeightedEdge({4, 5}, 2);
+
+    auto generator = graph.shortestPaths({0, 5});
+    const auto shortest = generator.next().value();
+    ASSERT_EQ(shortest.nodes, (std::vector<unsigned>{0, 2, 3, 5}));
+    ASSERT_EQ(shortest.length, 5);
+
+    // Paths come by non decreasing length, without repeated nodes
+    double previousLength = shortest.length;
+    size_t numberOfPaths = 1;
+    while (const auto path = generator.next())
+    {
+        ASSERT_GE(path->length, previousLength);
+        previousLength = path->length;
+        numberOfPaths++;
+
+        auto nodes = path->nodes;
+        std::ranges::sort(nodes);
+        ASSERT_TRUE(std::ranges::adjacent_find(nodes) == nodes.end());
+    }
+    ASSERT_EQ(graph.kShortestPaths({0, 5}, 3).back().length, 7);
+    ASSERT_EQ(graph.kShortestPaths({0, 5}, 100).size(), numberOfPaths);
+}
+
+TEST(WeightedGraphAlgorithmsTests, allPairsShortestPaths)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 1);
+    graph.addWeightedEdge({0, 2}, 5);
+    graph.addWeightedEdge({2, 3}, 1);
+
+    const auto floydWarshall =
+        graph.allPairsShortestPaths(jGraph::FLOYD_WARSHALL, true);
+    const auto johnson = graph.allPairsShortestPaths(jGraph::JOHNSON);
+    ASSERT_EQ(floydWarshall.nodes, johnson.nodes);
+    ASSERT_EQ(floydWarshall.distances, johnson.distances);
+    ASSERT_TRUE(johnson.nextNodes.empty());
+
+    const auto &nodes = floydWarshall.nodes;
+    const auto from = static_cast<size_t>(std::ranges::find(nodes, 0U) -
+                                          nodes.begin());
+    const auto to = static_cast<size_t>(std::ranges::find(nodes, 3U) -
+                                        nodes.begin());
+    ASSERT_EQ(floydWarshall.distances[(from * 4) + to], 3);
+    ASSERT_EQ(floydWarshall.getPath(from, to),
+              (std::vector<unsigned>{0, 1, 2, 3}));
+
+    graph.addWeightedEdge({3, 4}, -1);
+    for (const auto withPaths : {true, false})
+    {
+        ASSERT_TRUE(
+            graph.allPairsShortestPaths(jGraph::FLOYD_WARSHALL, withPaths)
+                .hasNegativeCycle);
+    }
+}
+
+TEST(WeightedGraphAlgorithmsTests, bellmanFord)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 1);
+    graph.addWeightedEdge({0, 2}, 5);
+    graph.addWeightedEdge({2, 3}, 1);
+
+    using EdgeType = std::pair<unsigned, unsigned>;
+    using DistanceType = std::pair<unsigned, double>;
+    for (const auto algorithm :
+         {jGraph::BELLMAN_FORD, jGraph::SPFA, jGraph::PARALLEL_BELLMAN_FORD})
+    {
+        const auto result = graph.bellmanFord(0, algorithm);
+        ASSERT_TRUE(result.negativeCycle.empty());
+        ASSERT_EQ(result.distances.size(), 4);
+        ASSERT_TRUE(
+            std::ranges::contains(result.distances, DistanceType{0, 0}));
+        ASSERT_TRUE(
+            std::ranges::contains(result.distances, DistanceType{3, 3}));
+        ASSERT_EQ(result.shortestPathTree.size(), 3);
+        ASSERT_TRUE(
+            std::ranges::contains(result.shortestPathTree, EdgeType{1, 2}));
+        ASSERT_TRUE(
+            std::ranges::contains(result.shortestPathTree, EdgeType{2, 3}));
+    }
+    ASSERT_TRUE(graph.negativeCycle().empty());
+
+    // An undirected edge with a negative weight is a negative cycle
+    graph.addWeightedEdge({3, 4}, -1);
+    for (const auto algorithm :
+         {jGraph::BELLMAN_FORD, jGraph::SPFA, jGraph::PARALLEL_BELLMAN_FORD})
+    {
+        const auto result = graph.bellmanFord(0, algorithm);
+        ASSERT_TRUE(result.distances.empty());
+        ASSERT_EQ(result.negativeCycle.size(), 2);
+        ASSERT_TRUE(std::ranges::contains(result.negativeCycle, 3));
+        ASSERT_TRUE(std::ranges::contains(result.negativeCycle, 4));
+    }
+    ASSERT_EQ(graph.negativeCycle().size(), 2);
+}
+
+TEST(WeightedGraphAlgorithmsTests, djikstra)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 1);
+    graph.addWeightedEdge({0, 2}, 5);
+    graph.addWeightedEdge({2, 3}, 1);
+
+    const auto previousNodes = graph.djikstra(0);
+    ASSERT_EQ(previousNodes.size(), 3);
+
+    using EdgeType = std::pair<unsigned, unsigned>;
+    ASSERT_TRUE(std::ranges::contains(previousNodes, EdgeType{0, 1}));
+    ASSERT_TRUE(std::ranges::contains(previousNodes, EdgeType{1, 2}));
+    ASSERT_TRUE(std::ranges::contains(previousNodes, EdgeType{2, 3}));
+}
@@ -2,8 +2,28 @@
 #include "DirectedMatrixGraph.hpp"
 #include "ListGraph.hpp"
 #include "MatrixGraph.hpp"
+#include "WeightedListGraph.hpp"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+template <typename T>
+double scoreOf(const std::vector<std::pair<T, double>> &scores,
+               std::type_identity_t<T> node)
+{
+    return std::ranges::find(scores, node, &std::pair<T, double>::first)
+        ->second;
+}
+} // namespace
+
 template <typename T>
 class GraphMeasuresTests : public ::testing::Test
 {
@@ -62,6 +82,105 @@ TYPED_TEST(GraphMeasuresTests, averageNeighborDegree)
     ASSERT_EQ(this->graph.averageNeighborDegree(), 1);
 }
 
+TYPED_TEST(GraphMeasuresTests, summaryStatistics)
+{
+    auto summary = this->graph.summaryStatistics();
+    ASSERT_EQ(summary.numberOfNodes, 0);
+    ASSERT_TRUE(summary.degreeHistogram.empty());
+    ASSERT_TRUE(std::isnan(summary.degreeAssortativity));
+
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({0, 2});
+    this->graph.addEdge({0, 3});
+    this->graph.addNode(4);
+    this->graph.addEdge({5, 6});
+
+    summary = this->graph.summaryStatistics();
+    ASSERT_EQ(summary.numberOfNodes, 7);
+    ASSERT_EQ(summary.numberOfEdges, 4);
+    ASSERT_EQ(summary.degreeHistogram, (std::vector<size_t>{1, 5, 0, 1}));
+    ASSERT_EQ(summary.minimumDegree, 0);
+    ASSERT_EQ(summary.maximumDegree, 3);
+    ASSERT_DOUBLE_EQ(summary.meanDegree, 8.0 / 7);
+    ASSERT_DOUBLE_EQ(summary.degreeVariance, 34.0 / 49);
+    ASSERT_DOUBLE_EQ(summary.degreeAssortativity, -0.6);
+    ASSERT_EQ(summary.selfLoops, 0);
+    ASSERT_EQ(summary.isolatedNodes, 1);
+
+    this->graph.addEdge({4, 4});
+    summary = this->graph.summaryStatistics();
+    ASSERT_EQ(summary.selfLoops, 1);
+    ASSERT_EQ(summary.isolatedNodes, 0);
+}
+
+TYPED_TEST(GraphMeasuresTests, degreesFollowChanges)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({0, 2});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 0});
+    this->graph.addEdge({3, 3});
+    this->graph.addEdge({2, 4});
+    this->graph.removeEdge({0, 1});
+    this->graph.removeNode(4);
+
+    const auto nodes = this->graph.getNodes();
+    const auto degrees = this->graph.degrees();
+    ASSERT_EQ(degrees.size(), 4);
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        ASSERT_EQ(degrees[i], this->graph.getNeighbors(nodes[i]).size());
+        ASSERT_EQ(this->graph.degree(nodes[i]), degrees[i]);
+    }
+    ASSERT_EQ(this->graph.degree(0), 1);
+    ASSERT_EQ(this->graph.degree(2), 2);
+}
+
+TYPED_TEST(DirectedGraphMeasuresTests, inAndOutDegrees)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({0, 2});
+    this->graph.addEdge({1, 0});
+    this->graph.addEdge({2, 2});
+
+    auto asVector = [](std::span<const size_t> degrees) {
+        return std::vector<size_t>(degrees.begin(), degrees.end());
+    };
+    ASSERT_EQ(asVector(this->graph.outDegrees()),
+              (std::vector<size_t>{2, 1, 1}));
+    ASSERT_EQ(asVector(this->graph.inDegrees()),
+              (std::vector<size_t>{1, 1, 2}));
+    ASSERT_EQ(asVector(this->graph.degrees()), (std::vector<size_t>{2, 1, 2}));
+
+    this->graph.removeEdge({1, 0});
+    ASSERT_EQ(this->graph.outDegree(1), 0);
+    ASSERT_EQ(this->graph.inDegree(0), 0);
+    ASSERT_EQ(this->graph.degree(0), 2);
+    ASSERT_EQ(this->graph.degree(1), 1);
+
+    this->graph.removeNode(2);
+    ASSERT_EQ(this->graph.getNumberOfEdges(), 1);
+    ASSERT_EQ(asVector(this->graph.degrees()), (std::vector<size_t>{1, 1}));
+    ASSERT_EQ(this->graph.outDegree(0), 1);
+    ASSERT_EQ(this->graph.inDegree(1), 1);
+}
+
+TEST(WeightedGraphMeasuresTests, degrees)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 2);
+    graph.addWeightedEdge({1, 2}, 3);
+    graph.addWeightedEdge({1, 3}, 4);
+    graph.removeEdge({1, 2});
+    graph.removeNode(3);
+
+    ASSERT_EQ(graph.degree(0), 1);
+    ASSERT_EQ(graph.degree(1), 1);
+    ASSERT_EQ(graph.degree(2), 0);
+    ASSERT_EQ(graph.inDegree(1), 1);
+    ASSERT_EQ(graph.outDegree(1), 1);
+}
+
 TYPED_TEST(SimpleGraphMeasuresTests, density)
 {
     ASSERT_EQ(this->graph.density(), 0);
@@ -91,3 +210,180 @@ TYPED_TEST(DirectedGraphMeasuresTests, density)
     this->graph.addEdge({2, 0});
     ASSERT_EQ(this->graph.density(), 0.5);
 }
+
+TYPED_TEST(GraphMeasuresTests, betweennessCentrality)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 3});
+
+    const auto scores = this->graph.betweennessCentrality();
+    ASSERT_EQ(scores.size(), 4);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 0), 0);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 1), 2);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 2), 2);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 3), 0);
+}
+
+TYPED_TEST(GraphMeasuresTests, sampledBetweennessCentrality)
+{
+    for (unsigned leaf = 1; leaf < 8; leaf++)
+    {
+        this->graph.addEdge({0, leaf});
+    }
+
+    ASSERT_EQ(this->graph.betweennessCentrality(8, 42),
+              this->graph.betweennessCentrality());
+    ASSERT_EQ(this->graph.betweennessCentrality(3, 7),
+              this->graph.betweennessCentrality(3, 7));
+}
+
+TYPED_TEST(SimpleGraphMeasuresTests, betweennessCentralitySplitsPaths)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({0, 2});
+    this->graph.addEdge({1, 3});
+    this->graph.addEdge({2, 3});
+
+    const auto scores = this->graph.betweennessCentrality();
+    for (const auto &[node, score] : scores)
+    {
+        ASSERT_DOUBLE_EQ(score, 0.5);
+    }
+}
+
+TEST(WeightedGraphMeasuresTests, betweennessCentrality)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 1);
+    graph.addWeightedEdge({0, 2}, 5);
+
+    const auto scores = graph.betweennessCentrality();
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 0), 0);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 1), 1);
+    ASSERT_DOUBLE_EQ(scoreOf(scores, 2), 0);
+}
+
+TYPED_TEST(SimpleGraphMeasuresTests, approximateNeighborhoodMeasures)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 3});
+    constexpr uint8_t log2Registers = 10;
+
+    const auto neighborhood =
+        this->graph.approximateNeighborhoodFunction(log2Registers);
+    ASSERT_EQ(neighborhood.size(), 4);
+    ASSERT_NEAR(neighborhood.at(0), 4, 0.1);
+    ASSERT_NEAR(neighborhood.at(1), 10, 0.2);
+    ASSERT_NEAR(neighborhood.at(2), 14, 0.3);
+    ASSERT_NEAR(neighborhood.at(3), 16, 0.3);
+
+    ASSERT_NEAR(this->graph.approximateEffectiveDiameter(0.9, log2Registers),
+                2.2, 0.2);
+
+    const auto closeness =
+        this->graph.approximateClosenessCentrality(log2Registers);
+    ASSERT_NEAR(scoreOf(closeness, 0), 0.5, 0.05);
+    ASSERT_NEAR(scoreOf(closeness, 1), 0.75, 0.05);
+
+    const auto harmonic =
+        this->graph.approximateHarmonicCentrality(log2Registers);
+    ASSERT_NEAR(scoreOf(harmonic, 0), 1 + (1.0 / 2) + (1.0 / 3), 0.05);
+    ASSERT_NEAR(scoreOf(harmonic, 1), 2.5, 0.05);
+
+    const auto eccentricities =
+        this->graph.approximateEccentricity(log2Registers);
+    for (const auto &[node, eccentricity] : eccentricities)
+    {
+        ASSERT_EQ(eccentricity, (node == 0 || node == 3) ? 3 : 2);
+    }
+}
+
+TYPED_TEST(SimpleGraphMeasuresTests, similarity)
+{
+    this->graph.addEdge({0, 2});
+    this->graph.addEdge({0, 3});
+    this->graph.addEdge({0, 4});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({1, 3});
+    this->graph.addEdge({3, 5});
+
+    using NodeType = decltype(this->graph.getNodes())::value_type;
+    const std::vector<std::pair<NodeType, NodeType>> pairs{{0, 1}, {4, 5}};
+
+    auto scores = this->graph.similarity(pairs, jGraph::COMMON_NEIGHBORS);
+    ASSERT_EQ(scores, (std::vector<double>{2, 0}));
+    scores = this->graph.similarity(pairs, jGraph::JACCARD);
+    ASSERT_DOUBLE_EQ(scores[0], 2.0 / 3);
+    scores = this->graph.similarity(pairs, jGraph::COSINE);
+    ASSERT_DOUBLE_EQ(scores[0], 2 / std::sqrt(6));
+    scores = this->graph.similarity(pairs, jGraph::ADAMIC_ADAR);
+    ASSERT_DOUBLE_EQ(scores[0], (1 / std::log(2)) + (1 / std::log(3)));
+    scores = this->graph.similarity(pairs, jGraph::RESOURCE_ALLOCATION);
+    ASSERT_DOUBLE_EQ(scores[0], (1.0 / 2) + (1.0 / 3));
+    ASSERT_EQ(scores[1], 0);
+
+    const auto closest =
+        this->graph.mostSimilarNodes(0, 3, jGraph::COMMON_NEIGHBORS);
+    ASSERT_EQ(closest.size(), 2);
+    ASSERT_EQ(closest[0].first, 1);
+    ASSERT_EQ(closest[0].second, 2);
+    ASSERT_EQ(closest[1].first, 5);
+    ASSERT_EQ(closest[1].second, 1);
+
+    const auto mostSimilar = this->graph.mostSimilarNodes(0, 1);
+    ASSERT_EQ(mostSimilar.size(), 1);
+    ASSERT_EQ(mostSimilar[0].first, 1);
+    ASSERT_DOUBLE_EQ(mostSimilar[0].second, 2.0 / 3);
+}
+
+TYPED_TEST(GraphMeasuresTests, diameterAndRadius)
+{
+    ASSERT_EQ(this->graph.diameter(), 0);
+
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 3});
+    this->graph.addEdge({3, 4});
+    this->graph.addEdge({1, 5});
+    ASSERT_EQ(this->graph.diameter(), 4);
+    ASSERT_EQ(this->graph.radius(), 2);
+
+    this->graph.addEdge({6, 7});
+    ASSERT_EQ(this->graph.diameter(), std::numeric_limits<double>::infinity());
+}
+
+TYPED_TEST(SimpleGraphMeasuresTests, componentsDiameterAndRadius)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 3});
+    this->graph.addEdge({3, 4});
+    this->graph.addEdge({5, 6});
+    this->graph.addEdge({6, 7});
+    this->graph.addEdge({7, 5});
+    this->graph.addNode(8);
+
+    const auto components = this->graph.componentsDiameterAndRadius();
+    ASSERT_EQ(components.size(), 3);
+    for (const auto &[component, diameter, radius] : components)
+    {
+        const auto expected = std::pair<double, double>{
+            component.size() == 5 ? 4 : (component.size() == 3 ? 1 : 0),
+            component.size() == 5 ? 2 : (component.size() == 3 ? 1 : 0)};
+        ASSERT_EQ(std::pair(diameter, radius), expected);
+    }
+}
+
+TEST(WeightedGraphMeasuresTests, diameterAndRadius)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({0, 1}, 1);
+    graph.addWeightedEdge({1, 2}, 2);
+    graph.addWeightedEdge({2, 3}, 3);
+
+    ASSERT_DOUBLE_EQ(graph.diameter(), 6);
+    ASSERT_DOUBLE_EQ(graph.radius(), 3);
+}
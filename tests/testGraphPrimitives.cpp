@@ -7,6 +7,10 @@
 #include "gtest/gtest.h"
 
 #include <algorithm>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -51,6 +55,20 @@ using DirectedGraphs =
                      jGraph::DirectedListGraph<long long>>;
 TYPED_TEST_SUITE(DirectedGraphPrimitivesTests, DirectedGraphs);
 
+template <typename T>
+class SortedGraphPrimitivesTests : public ::testing::Test
+{
+  public:
+    T graph;
+    T sortedGraph;
+};
+using SortableGraphs =
+    ::testing::Types<jGraph::ListGraph<unsigned>,
+                     jGraph::ListGraph<long long, short>,
+                     jGraph::DirectedListGraph<unsigned>,
+                     jGraph::DirectedListGraph<long long, short>>;
+TYPED_TEST_SUITE(SortedGraphPrimitivesTests, SortableGraphs);
+
 TYPED_TEST(GraphPrimitivesTests, initEmptyGraph)
 {
     ASSERT_EQ(this->graph.getNumberOfNodes(), 0);
@@ -92,6 +110,143 @@ TYPED_TEST(GraphPrimitivesTests, removeNodeNotInGraph)
     ASSERT_EQ(this->graph.getNumberOfNodes(), 2);
 }
 
+TYPED_TEST(GraphPrimitivesTests, removeNodeKeepsOtherNodes)
+{
+    this->graph.addEdge({0, 1});
+    this->graph.addEdge({1, 2});
+    this->graph.addEdge({2, 3});
+    this->graph.addEdge({3, 0});
+    this->graph.removeNode(0);
+
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 3);
+    ASSERT_EQ(this->graph.getNumberOfEdges(), 2);
+    ASSERT_FALSE(std::ranges::contains(this->graph.getNodes(), 0));
+    ASSERT_TRUE(this->graph.hasEdge({1, 2}));
+    ASSERT_TRUE(this->graph.hasEdge({2, 3}));
+    ASSERT_FALSE(this->graph.hasEdge({1, 3}));
+    ASSERT_EQ(this->graph.degree(3), 1);
+
+    this->graph.addEdge({0, 3});
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 4);
+    ASSERT_TRUE(this->graph.hasEdge({0, 3}));
+    ASSERT_TRUE(this->graph.hasEdge({2, 3}));
+    ASSERT_EQ(this->graph.degree(0), 1);
+}
+
+TYPED_TEST(GraphPrimitivesTests, removeNodesAtOnce)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> edges{
+        {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 0}, {1, 3}, {2, 2}, {5, 1}};
+    this->graph.addEdge(edges);
+
+    std::vector<nodeType> nodes{2, 4, 7, 2};
+    this->graph.removeNode(nodes);
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 4);
+    ASSERT_EQ(this->graph.getNumberOfEdges(), 3);
+    ASSERT_FALSE(std::ranges::contains(this->graph.getNodes(), 2));
+    ASSERT_TRUE(this->graph.hasEdge({0, 1}));
+    ASSERT_TRUE(this->graph.hasEdge({1, 3}));
+    ASSERT_TRUE(this->graph.hasEdge({5, 1}));
+    ASSERT_FALSE(this->graph.hasEdge({0, 3}));
+    ASSERT_EQ(this->graph.degree(1), 3);
+    ASSERT_EQ(this->graph.degree(3), 1);
+
+    this->graph.addEdge({2, 0});
+    ASSERT_TRUE(this->graph.hasEdge({2, 0}));
+    ASSERT_EQ(this->graph.degree(0), 2);
+}
+
+TYPED_TEST(GraphPrimitivesTests, removeEdgesAtOnce)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> edges{
+        {0, 1}, {1, 2}, {2, 3}, {3, 0}, {1, 3}, {2, 2}};
+    this->graph.addEdge(edges);
+
+    std::vector<std::pair<nodeType, nodeType>> removedEdges{
+        {1, 2}, {2, 2}, {1, 2}, {3, 0}, {0, 9}, {0, 2}};
+    this->graph.removeEdge(removedEdges);
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 4);
+    ASSERT_EQ(this->graph.getNumberOfEdges(), 3);
+    ASSERT_FALSE(this->graph.hasEdge({1, 2}));
+    ASSERT_FALSE(this->graph.hasEdge({2, 2}));
+    ASSERT_FALSE(this->graph.hasEdge({3, 0}));
+    ASSERT_TRUE(this->graph.hasEdge({0, 1}));
+    ASSERT_TRUE(this->graph.hasEdge({2, 3}));
+    ASSERT_EQ(this->graph.degree(2), 1);
+    ASSERT_EQ(this->graph.degree(3), 2);
+}
+
+TYPED_TEST(GraphPrimitivesTests, sparseNodeNames)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    const auto largest = std::numeric_limits<nodeType>::max();
+    const auto smallest = std::numeric_limits<nodeType>::min();
+    this->graph.addEdge({3, 2});
+    this->graph.addEdge({2, 1});
+    this->graph.addEdge({largest, 3});
+    this->graph.addEdge({smallest, largest});
+    this->graph.removeNode(2);
+
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 4);
+    ASSERT_TRUE(this->graph.hasEdge({largest, 3}));
+    ASSERT_TRUE(this->graph.hasEdge({smallest, largest}));
+    ASSERT_FALSE(this->graph.hasEdge({3, 1}));
+    ASSERT_EQ(this->graph.degree(largest), 2);
+    ASSERT_EQ(this->graph.degree(1), 0);
+}
+
+TEST(NameIndexMapTests, sameIndexesWithEveryMapping)
+{
+    jGraph::internals::NameIndexMap<int, unsigned, jGraph::DENSE_OFFSET> dense;
+    jGraph::internals::NameIndexMap<int, unsigned, jGraph::FLAT_HASH> hashed;
+    std::vector<int> names{5, -3, 9, 4, 1 << 30, -7, 8};
+    for (const auto name : names)
+    {
+        ASSERT_TRUE(dense.addByName(name));
+        ASSERT_TRUE(hashed.addByName(name));
+    }
+    ASSERT_FALSE(dense.addByName(9));
+    dense.removeByName(-3);
+    hashed.removeByName(-3);
+    std::vector<int> removedNames{4, 11, 8};
+    ASSERT_EQ(dense.removeByName(removedNames),
+              hashed.removeByName(removedNames));
+
+    ASSERT_EQ(dense.getSize(), 4);
+    ASSERT_FALSE(dense.contains(-3));
+    ASSERT_THROW(std::ignore = dense.convertNodeNameToIndex(4),
+                 std::out_of_range);
+    for (unsigned index = 0; index < dense.getSize(); index++)
+    {
+        const auto name = dense.convertIndexToNodeName(index);
+        ASSERT_EQ(hashed.convertIndexToNodeName(index), name);
+        ASSERT_EQ(dense.convertNodeNameToIndex(name), index);
+        ASSERT_EQ(hashed.convertNodeNameToIndex(name), index);
+    }
+}
+
+TEST(NameIndexMapTests, sparseThenDenseNames)
+{
+    jGraph::internals::NameIndexMap<long long, unsigned> names;
+    std::vector<long long> added{0, 1'000'000};
+    for (long long name = -300; name < 300; name++)
+        added.emplace_back(name * 7 % 600);
+    for (const auto name : added)
+        names.addByName(name);
+    names.removeByName(1'000'000);
+
+    ASSERT_EQ(names.getSize(), 600);
+    ASSERT_FALSE(names.contains(1'000'000));
+    for (unsigned index = 0; index < names.getSize(); index++)
+    {
+        ASSERT_EQ(names.convertNodeNameToIndex(
+                      names.convertIndexToNodeName(index)),
+                  index);
+    }
+}
+
 TYPED_TEST(DirectedGraphPrimitivesTests, removeNodeWithEdges)
 {
     this->graph.addEdge({0, 1});
@@ -305,3 +460,229 @@ TYPED_TEST(DirectedGraphPrimitivesTests, outgoingNeighbors)
     this->graph.addEdge({1, 2});
     ASSERT_EQ(this->graph.getOutgoingNeighbors(1).size(), 1);
 }
+
+TYPED_TEST(SortedGraphPrimitivesTests, sortedAdjacency)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> firstEdges{
+        {5, 1}, {1, 5}, {3, 3}, {0, 4}, {5, 1}, {2, 0}};
+    std::vector<std::pair<nodeType, nodeType>> secondEdges{
+        {4, 0}, {1, 2}, {0, 1}, {0, 4}, {5, 3}};
+    for (auto *current : {&this->graph, &this->sortedGraph})
+    {
+        for (nodeType node = 0; node < 6; node++)
+            current->addNode(node);
+        current->addEdge({2, 5});
+    }
+    auto &sorted = this->sortedGraph;
+    sorted.setSortedAdjacency(true);
+    ASSERT_TRUE(sorted.isAdjacencySorted());
+    ASSERT_FALSE(this->graph.isAdjacencySorted());
+
+    for (auto *current : {&this->graph, &this->sortedGraph})
+    {
+        current->addEdge(firstEdges);
+        current->addEdge({3, 1});
+        current->addEdge(secondEdges);
+    }
+
+    ASSERT_EQ(sorted.getNumberOfEdges(), this->graph.getNumberOfEdges());
+    auto edges = this->graph.getEdges();
+    auto sortedEdges = sorted.getEdges();
+    std::ranges::sort(edges);
+    std::ranges::sort(sortedEdges);
+    ASSERT_EQ(sortedEdges, edges);
+
+    for (nodeType first = 0; first < 6; first++)
+    {
+        if constexpr (requires { sorted.getOutgoingNeighbors(first); })
+        {
+            ASSERT_TRUE(
+                std::ranges::is_sorted(sorted.getOutgoingNeighbors(first)));
+        }
+        else
+        {
+            ASSERT_TRUE(std::ranges::is_sorted(sorted.getNeighbors(first)));
+        }
+        ASSERT_EQ(sorted.degree(first), this->graph.degree(first));
+        for (nodeType second = 0; second < 6; second++)
+        {
+            ASSERT_EQ(sorted.hasEdge({first, second}),
+                      this->graph.hasEdge({first, second}));
+        }
+    }
+}
+
+TEST(WeightedGraphPrimitivesTests, sortedAdjacency)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    for (unsigned node = 0; node < 5; node++)
+        graph.addNode(node);
+    graph.addWeightedEdge({3, 1}, 7);
+    graph.setSortedAdjacency(true);
+    std::vector<std::tuple<unsigned, unsigned, float>> edges{
+        {2, 0, 4}, {1, 3, 9}, {0, 1, 2}, {0, 2, 5}, {4, 4, 1}};
+    graph.addWeightedEdge(edges);
+    graph.addWeightedEdge({1, 4}, 3);
+    graph.setWeight({1, 0}, 6);
+
+    ASSERT_EQ(graph.getNumberOfEdges(), 5);
+    ASSERT_EQ(graph.getWeight({1, 3}), 7);
+    ASSERT_EQ(graph.getWeight({0, 2}), 4);
+    ASSERT_EQ(graph.getWeight({0, 1}), 6);
+    ASSERT_EQ(graph.getWeight({4, 1}), 3);
+    ASSERT_EQ(graph.getWeight({2, 3}), std::nullopt);
+    ASSERT_TRUE(graph.hasEdge({4, 4}));
+    ASSERT_TRUE(graph.hasEdge({1, 4}));
+    ASSERT_FALSE(graph.hasEdge({2, 4}));
+    ASSERT_EQ(graph.degree(4), 3);
+    for (const unsigned node : {0U, 1U, 2U, 3U, 4U})
+        ASSERT_TRUE(std::ranges::is_sorted(graph.getNeighbors(node)));
+}
+
+TYPED_TEST(SortedGraphPrimitivesTests, hubNeighbors)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> edges;
+    for (nodeType leaf = 1; leaf < 20; leaf++)
+        edges.emplace_back(0, leaf);
+
+    this->sortedGraph.setSortedAdjacency(true);
+    for (auto *current : {&this->graph, &this->sortedGraph})
+    {
+        current->setHubThreshold(4);
+        ASSERT_EQ(current->getHubThreshold(), 4);
+        current->addEdge(edges);
+        current->addEdge({0, 5});
+        current->addEdge({0, 0});
+        current->addEdge({3, 7});
+
+        ASSERT_EQ(current->getNumberOfEdges(), 21);
+        ASSERT_TRUE(current->hasEdge({0, 12}));
+        ASSERT_TRUE(current->hasEdge({0, 0}));
+        ASSERT_FALSE(current->hasEdge({2, 5}));
+
+        current->removeEdge({0, 0});
+        ASSERT_EQ(current->getNumberOfEdges(), 20);
+        ASSERT_FALSE(current->hasEdge({0, 0}));
+
+        for (nodeType leaf = 2; leaf < 19; leaf++)
+            current->removeEdge({0, leaf});
+        ASSERT_EQ(current->getNumberOfEdges(), 3);
+        ASSERT_TRUE(current->hasEdge({0, 19}));
+        ASSERT_FALSE(current->hasEdge({0, 12}));
+
+        current->removeNode(19);
+        ASSERT_TRUE(current->hasEdge({0, 1}));
+        ASSERT_TRUE(current->hasEdge({3, 7}));
+        ASSERT_FALSE(current->hasEdge({0, 5}));
+        ASSERT_EQ(current->getNumberOfEdges(), 2);
+    }
+}
+
+TYPED_TEST(SortedGraphPrimitivesTests, removeNode)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> edges{
+        {5, 0}, {5, 1}, {5, 2}, {5, 3}, {5, 4}, {5, 5}, {1, 3}, {0, 2}};
+
+    this->sortedGraph.setSortedAdjacency(true);
+    for (auto *current : {&this->graph, &this->sortedGraph})
+    {
+        current->setHubThreshold(2);
+        for (nodeType node = 0; node < 6; node++)
+            current->addNode(node);
+        current->addEdge(edges);
+
+        // The last node, a hub with a self-loop, takes the removed index
+        current->removeNode(0);
+        ASSERT_EQ(current->getNumberOfNodes(), 5);
+        ASSERT_EQ(current->getNumberOfEdges(), 6);
+        ASSERT_TRUE(current->hasEdge({5, 5}));
+        ASSERT_TRUE(current->hasEdge({5, 2}));
+        ASSERT_TRUE(current->hasEdge({1, 3}));
+        ASSERT_EQ(current->degree(2), 1);
+
+        current->removeNode(3);
+        ASSERT_EQ(current->getNumberOfEdges(), 4);
+        ASSERT_TRUE(current->hasEdge({5, 4}));
+        ASSERT_FALSE(current->hasEdge({1, 4}));
+    }
+
+    // Names no longer follow indexes, so sorted lists are checked through
+    // the binary searches of the sorted graph
+    const auto nodes = this->graph.getNodes();
+    for (const auto first : nodes)
+    {
+        for (const auto second : nodes)
+        {
+            ASSERT_EQ(this->sortedGraph.hasEdge({first, second}),
+                      this->graph.hasEdge({first, second}));
+        }
+    }
+}
+
+TYPED_TEST(GraphPrimitivesTests, buildFromEdges)
+{
+    using nodeType = typename decltype(this->graph.getNodes())::value_type;
+    std::vector<std::pair<nodeType, nodeType>> edges{
+        {7, 2}, {2, 7}, {3, 3}, {9, 2}, {7, 2}, {3, 9}, {4, 7}, {9, 3}};
+    TypeParam expected;
+    expected.addEdge(edges);
+
+    this->graph.addEdge({1, 5});
+    this->graph.buildFromEdges(edges);
+
+    ASSERT_EQ(this->graph.getNumberOfNodes(), 5);
+    ASSERT_EQ(this->graph.getNumberOfEdges(), expected.getNumberOfEdges());
+    auto builtEdges = this->graph.getEdges();
+    auto expectedEdges = expected.getEdges();
+    std::ranges::sort(builtEdges);
+    std::ranges::sort(expectedEdges);
+    ASSERT_EQ(builtEdges, expectedEdges);
+
+    const auto nodes = expected.getNodes();
+    for (const auto first : nodes)
+    {
+        ASSERT_EQ(this->graph.degree(first), expected.degree(first));
+        for (const auto second : nodes)
+        {
+            ASSERT_EQ(this->graph.hasEdge({first, second}),
+                      expected.hasEdge({first, second}));
+        }
+    }
+}
+
+TEST(WeightedGraphPrimitivesTests, buildFromWeightedEdges)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    std::vector<std::tuple<unsigned, unsigned, float>> edges{
+        {4, 1, 2}, {1, 4, 5}, {2, 2, 3}, {1, 6, 7}};
+    graph.buildFromWeightedEdges(edges);
+
+    ASSERT_EQ(graph.getNumberOfNodes(), 4);
+    ASSERT_EQ(graph.getNumberOfEdges(), 3);
+    ASSERT_EQ(graph.getWeight({1, 4}), 2);
+    ASSERT_EQ(graph.getWeight({6, 1}), 7);
+    ASSERT_EQ(graph.getWeight({2, 2}), 3);
+    ASSERT_EQ(graph.degree(2), 2);
+    ASSERT_EQ(graph.getNodes(), (std::vector<unsigned>{1, 2, 4, 6}));
+}
+
+TEST(WeightedGraphPrimitivesTests, removeSelfLoop)
+{
+    jGraph::WeightedListGraph<unsigned> graph;
+    graph.addWeightedEdge({1, 1}, 2);
+    graph.addWeightedEdge({1, 2}, 3);
+    graph.removeEdge({1, 1});
+
+    ASSERT_FALSE(graph.hasEdge({1, 1}));
+    ASSERT_EQ(graph.getNumberOfEdges(), 1);
+    ASSERT_EQ(graph.degree(1), 1);
+
+    graph.removeEdge({1, 1});
+    ASSERT_EQ(graph.getNumberOfEdges(), 1);
+    graph.removeEdge({2, 1});
+    ASSERT_EQ(graph.getNumberOfEdges(), 0);
+    ASSERT_EQ(graph.degree(1), 0);
+}